@@ -0,0 +1,38 @@
+#include <StormByte/config/parser/arena.hxx>
+
+using namespace StormByte::Config::Parser;
+
+void Arena::Return::operator()(std::pmr::memory_resource* resource) const noexcept {
+	std::lock_guard<std::mutex> lock(arena->m_mutex);
+	// Capacity was reserved when leasing so this can not throw
+	arena->m_available.push_back(resource);
+}
+
+Arena::Lease Arena::Acquire(const std::weak_ptr<Arena>& arena) {
+	auto owner = arena.lock();
+	if (!owner)
+		return Lease(nullptr, Return { nullptr });
+
+	std::lock_guard<std::mutex> lock(owner->m_mutex);
+	std::pmr::memory_resource* resource;
+	if (owner->m_available.empty()) {
+		owner->m_resources.push_back(std::make_unique<std::pmr::monotonic_buffer_resource>());
+		owner->m_available.reserve(owner->m_resources.size());
+		resource = owner->m_resources.back().get();
+	}
+	else {
+		resource = owner->m_available.back();
+		owner->m_available.pop_back();
+	}
+	return Lease(resource, Return { std::move(owner) });
+}
+
+void Arena::Retain(std::shared_ptr<const Arena> arena) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_retained.push_back(std::move(arena));
+}
+
+void Arena::Retain(std::shared_ptr<const Source> source) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_sources.push_back(std::move(source));
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <StormByte/config/parser/source.hxx>
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class Arena
+	 * @brief Bump allocated memory the parsed items of a configuration are built in
+	 *
+	 * Every builder leases a monotonic resource for itself (so parallel builders do not
+	 * contend) and gives it back when done for later builders to keep filling it. Freed
+	 * items are not reclaimed, all the memory is released at once when the arena is destroyed,
+	 * so no item built in it can outlive it. Sources viewed by parsed strings are kept here
+	 * too, with the same rule.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Arena {
+		public:
+			/**
+			 * @struct Return
+			 * @brief Gives a leased resource back to its arena
+			 */
+			struct Return {
+				std::shared_ptr<Arena> arena;						///< Arena the resource belongs to (kept alive while leased)
+
+				/**
+				 * Gives the resource back
+				 * @param resource leased resource
+				 */
+				void 												operator()(std::pmr::memory_resource* resource) const noexcept;
+			};
+
+			/**
+			 * Resource leased to a single builder
+			 */
+			using Lease = std::unique_ptr<std::pmr::memory_resource, Return>;
+
+			/**
+			 * Constructor
+			 */
+			Arena() noexcept 										= default;
+
+			/**
+			 * Copy constructor
+			 */
+			Arena(const Arena&) 									= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Arena(Arena&&) 											= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			Arena& operator=(const Arena&) 							= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Arena& operator=(Arena&&) 								= delete;
+
+			/**
+			 * Destructor (releases all the memory)
+			 */
+			~Arena() noexcept 										= default;
+
+			/**
+			 * Leases a resource to build items in
+			 * @param arena arena to lease from
+			 * @return leased resource (null if the arena no longer exists)
+			 */
+			static Lease 											Acquire(const std::weak_ptr<Arena>& arena);
+
+			/**
+			 * Keeps another arena alive as long as this one (when its items are moved here)
+			 * @param arena arena to retain
+			 */
+			void 													Retain(std::shared_ptr<const Arena> arena);
+
+			/**
+			 * Keeps a source alive as long as this arena (when parsed strings view it)
+			 * @param source source to retain
+			 */
+			void 													Retain(std::shared_ptr<const Source> source);
+
+		private:
+			std::mutex m_mutex;										///< Mutex for the resources
+			std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> m_resources;	///< Every resource created
+			std::vector<std::pmr::memory_resource*> m_available;	///< Resources not leased
+			std::vector<std::shared_ptr<const Arena>> m_retained;	///< Arenas whose items were moved here
+			std::vector<std::shared_ptr<const Source>> m_sources;	///< Sources viewed by parsed strings
+	};
+}
@@ -0,0 +1,217 @@
+#include <StormByte/config/item/comment.hxx>
+#include <StormByte/config/item/list.hxx>
+#include <StormByte/config/item/value.hxx>
+#include <StormByte/config/parser/builder.hxx>
+#include <StormByte/config/parser/fragment.hxx>
+
+#include <functional>
+#include <type_traits>
+
+using namespace StormByte::Config::Parser;
+
+Builder::Builder(Item::Container& root, const OnExistingAction& action, const OnCommentAction& comments, std::shared_ptr<const std::filesystem::path> directory, Context context):
+m_root(root), c_on_existing_action(action), c_on_comment_action(comments), c_directory(std::move(directory)), c_context(std::move(context)), m_lease(Arena::Acquire(c_context.arena)), m_position(nullptr) {}
+
+Builder::~Builder() noexcept {
+	// Locations are not worth failing for
+	if (c_context.map && !m_located.empty()) {
+		try {
+			c_context.map->Record(m_located);
+		}
+		catch (...) {}
+	}
+}
+
+void Builder::OnGroupBegin(std::string_view name) {
+	Item::Base::PointerType group = Make<Item::Group>();
+	if (!name.empty())
+		group->Name(name);
+	Record(group);
+	m_open.push_back(std::move(group));
+}
+
+void Builder::OnListBegin(std::string_view name) {
+	auto list = Make<Item::List>();
+	list->Mode(c_context.lists);
+	if (!name.empty())
+		list->Name(name);
+	Record(list);
+	m_open.push_back(std::move(list));
+}
+
+void Builder::OnEnd(const Item::ContainerType&) {
+	// End of the root itself when materializing a lazily parsed container
+	if (m_open.empty()) {
+		Seal(m_root);
+		return;
+	}
+	auto container = std::move(m_open.back());
+	m_open.pop_back();
+	Seal(container->Value<Item::Container>());
+	Target().Insert(std::move(container), c_on_existing_action);
+}
+
+void Builder::OnValue(std::string_view name, int value) {
+	if (!Pack(name, value))
+		Add(Make<Item::Value<int>>(value), name);
+}
+
+void Builder::OnValue(std::string_view name, double value) {
+	if (!Pack(name, value))
+		Add(Make<Item::Value<double>>(value), name);
+}
+
+void Builder::OnValue(std::string_view name, bool value) {
+	if (!Pack(name, value))
+		Add(Make<Item::Value<bool>>(value), name);
+}
+
+void Builder::OnValue(std::string_view name, std::string_view value) {
+	auto item = MakeText<Item::Value<std::string>>(value);
+	Attach(*item);
+	Add(std::move(item), name);
+}
+
+void Builder::OnComment(const Item::CommentType& type, std::string_view text) {
+	if (c_on_comment_action == OnCommentAction::Discard)
+		return;
+
+	switch(type) {
+		case Item::CommentType::SingleLineBash:
+			Target().Insert(MakeText<Item::Comment<Item::CommentType::SingleLineBash>>(text), c_on_existing_action);
+			break;
+		case Item::CommentType::SingleLineC:
+			Target().Insert(MakeText<Item::Comment<Item::CommentType::SingleLineC>>(text), c_on_existing_action);
+			break;
+		case Item::CommentType::MultiLineC:
+			Target().Insert(MakeText<Item::Comment<Item::CommentType::MultiLineC>>(text), c_on_existing_action);
+			break;
+	}
+}
+
+void Builder::OnInclude(std::string_view path) {
+	std::filesystem::path target(path);
+	if (target.is_relative() && c_directory)
+		target = *c_directory / target;
+
+	// Items of the cached fragment are shared, and copied on write by whoever modifies them
+	const auto fragment = FragmentCache::Instance().Get(target, c_on_existing_action, c_on_comment_action, c_context.lists, c_context.packs, c_context.locations != nullptr, c_context.resolver != nullptr);
+	if (c_context.locations && fragment.locations)
+		c_context.locations->Add(*fragment.locations);
+	Item::Container& current = Target();
+	for (const auto& item: fragment.group->Items())
+		current.Insert(Adopt(item, fragment.locations.get()), c_on_existing_action);
+}
+
+void Builder::OnDeferred(const Item::ContainerType& type, std::string_view name, Deferred&& deferred) {
+	Item::Base::PointerType container;
+	if (type == Item::ContainerType::Group)
+		container = Make<Item::Group>();
+	else {
+		auto list = Make<Item::List>();
+		list->Mode(c_context.lists);
+		container = std::move(list);
+	}
+	deferred.action = c_on_existing_action;
+	deferred.comments = c_on_comment_action;
+	deferred.directory = c_directory;
+	deferred.context = c_context;
+	// Its values are only attached when parsed, but the ones it will have are known by now
+	if (c_context.resolver && deferred.body.find("${") != std::string_view::npos)
+		container->Value<Item::Container>().m_references = true;
+	container->Value<Item::Container>().m_deferred = std::make_shared<const Deferred>(std::move(deferred));
+	Add(std::move(container), name);
+}
+
+StormByte::Config::Item::Container& Builder::Current() noexcept {
+	if (m_open.empty())
+		return m_root;
+	return m_open.back()->Value<Item::Container>();
+}
+
+StormByte::Config::Item::Container& Builder::Target() {
+	Item::Container& current = Current();
+	// Values are packed only while nothing else is added to the list
+	if (current.m_packed)
+		Flush(static_cast<Item::List&>(current));
+	return current;
+}
+
+void Builder::Seal(Item::Container& container) {
+	if (!container.m_packed)
+		return;
+	auto& list = static_cast<Item::List&>(container);
+	if (!list.IsSealable())
+		Flush(list);
+	// Packed values have no location
+	else if (c_context.map)
+		m_packed_offsets.resize(m_packed_offsets.size() - list.Size());
+}
+
+void Builder::Flush(Item::List& list) {
+	std::visit([this, &list](const auto& values) {
+		using Values = std::remove_cvref_t<decltype(values)>;
+		if constexpr (!std::is_same_v<Values, std::monostate>) {
+			const std::size_t first = c_context.map ? m_packed_offsets.size() - values.size() : 0;
+			for (std::size_t index = 0; index < values.size(); index++) {
+				auto item = Make<Item::Value<typename Values::value_type>>(values[index]);
+				if (c_context.map && m_packed_offsets[first + index] != std::string_view::npos)
+					m_located.push_back({ item, m_packed_offsets[first + index] });
+				list.Insert(std::move(item), c_on_existing_action);
+			}
+			if (c_context.map)
+				m_packed_offsets.resize(first);
+		}
+	}, list.Release());
+}
+
+StormByte::Config::Item::Base::PointerType Builder::Adopt(const Item::Base::PointerType& item, const Locations* sources) const {
+	if (!c_context.resolver || !Item::Container::Resolves(*item))
+		return item;
+
+	auto copy = item->Clone();
+	if (copy->Type() == Item::Type::Container) {
+		for (auto& child: copy->Value<Item::Container>().m_items.Edit())
+			child = Adopt(child, sources);
+	}
+	else
+		static_cast<Item::Value<std::string>&>(*copy).References(c_context.resolver);
+
+	if (c_context.locations && sources) {
+		if (const auto map = sources->Holding(*item)) {
+			std::vector<SourceMap::Entry> located { { copy, *map->Offset(*item) } };
+			map->Record(located);
+		}
+	}
+	return copy;
+}
+
+void Builder::Attach(Item::Base& item) const {
+	auto& value = static_cast<Item::Value<std::string>&>(item);
+	if (c_context.resolver && value.View().find("${") != std::string_view::npos)
+		value.References(c_context.resolver);
+}
+
+void Builder::Record(const Item::Base::PointerType& item) {
+	if (c_context.map && m_position)
+		m_located.push_back({ item, Offset() });
+}
+
+bool Builder::IsRetained(std::string_view text) const noexcept {
+	const std::string_view source = c_context.source;
+	const std::less_equal<const char*> before;
+	return !source.empty() && before(source.data(), text.data()) && before(text.data() + text.size(), source.data() + source.size());
+}
+
+std::size_t Builder::Offset() const noexcept {
+	if (!c_context.map || !m_position)
+		return std::string_view::npos;
+	return static_cast<std::size_t>(m_position - c_context.map->View().data());
+}
+
+void Builder::Add(Item::Base::PointerType item, std::string_view name) {
+	if (!name.empty())
+		item->Name(name);
+	Record(item);
+	Target().Insert(std::move(item), c_on_existing_action);
+}
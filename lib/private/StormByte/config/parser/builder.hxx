@@ -0,0 +1,271 @@
+#pragma once
+
+#include <StormByte/config/handler.hxx>
+#include <StormByte/config/item/group.hxx>
+#include <StormByte/config/item/list.hxx>
+#include <StormByte/config/item/value.hxx>
+#include <StormByte/config/parser/context.hxx>
+#include <StormByte/config/parser/deferred.hxx>
+#include <StormByte/config/type.hxx>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class Builder
+	 * @brief Handler building an item tree from parse events
+	 *
+	 * Containers are built apart and only added to their parent when they end, so
+	 * the action to take when a name already exists applies to complete containers.
+	 * Item offsets are kept apart too and recorded to the source map when done.
+	 * When the context has an arena, items are built in a resource leased for the
+	 * whole build.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Builder final: public Handler {
+		public:
+			/**
+			 * Constructor
+			 * @param root container to add parsed items to
+			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param directory directory relative includes are resolved from (null for working directory)
+			 * @param context what the built items are attached to
+			 */
+			Builder(Item::Container& root, const OnExistingAction& action, const OnCommentAction& comments, std::shared_ptr<const std::filesystem::path> directory, Context context);
+
+			/**
+			 * Copy constructor
+			 */
+			Builder(const Builder&) 								= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Builder(Builder&&) noexcept 							= default;
+
+			/**
+			 * Assignment operator
+			 */
+			Builder& operator=(const Builder&) 						= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Builder& operator=(Builder&&) noexcept 					= delete;
+
+			/**
+			 * Destructor (records the item offsets)
+			 */
+			~Builder() noexcept override;
+
+			/**
+			 * Sets where the next item starts
+			 * @param position position in the source being parsed
+			 */
+			inline void 											Locate(const char* position) noexcept {
+				m_position = position;
+			}
+
+			/**
+			 * Starts a group
+			 * @param name group name
+			 */
+			void 													OnGroupBegin(std::string_view name) override;
+
+			/**
+			 * Starts a list
+			 * @param name list name
+			 */
+			void 													OnListBegin(std::string_view name) override;
+
+			/**
+			 * Ends current container adding it to its parent
+			 * @param type container type
+			 */
+			void 													OnEnd(const Item::ContainerType& type) override;
+
+			/**
+			 * Adds an integer item
+			 * @param name item name
+			 * @param value item value
+			 */
+			void 													OnValue(std::string_view name, int value) override;
+
+			/**
+			 * Adds a double item
+			 * @param name item name
+			 * @param value item value
+			 */
+			void 													OnValue(std::string_view name, double value) override;
+
+			/**
+			 * Adds a bool item
+			 * @param name item name
+			 * @param value item value
+			 */
+			void 													OnValue(std::string_view name, bool value) override;
+
+			/**
+			 * Adds a string item
+			 * @param name item name
+			 * @param value item value
+			 */
+			void 													OnValue(std::string_view name, std::string_view value) override;
+
+			/**
+			 * Adds a comment item (unless comments are discarded)
+			 * @param type comment type
+			 * @param text comment text
+			 */
+			void 													OnComment(const Item::CommentType& type, std::string_view text) override;
+
+			/**
+			 * Adds copies of the items of an included file (parsed only once through the fragment cache)
+			 * @param path included path
+			 * @throw FileIOError if file can not be read
+			 * @throw ParseError if file contents can not be parsed
+			 */
+			void 													OnInclude(std::string_view path) override;
+
+			/**
+			 * Adds a container whose contents will be parsed on first access
+			 * @param type container type
+			 * @param name container name
+			 * @param deferred unparsed contents (settings are set by the builder)
+			 */
+			void 													OnDeferred(const Item::ContainerType& type, std::string_view name, Deferred&& deferred);
+
+		private:
+			Item::Container& m_root;								///< Root container
+			const OnExistingAction c_on_existing_action;			///< Action to take when item name already exists
+			const OnCommentAction c_on_comment_action;				///< What to do with comments
+			const std::shared_ptr<const std::filesystem::path> c_directory;	///< Directory relative includes are resolved from
+			const Context c_context;								///< What the built items are attached to
+			Arena::Lease m_lease;									///< Resource items are built in (null to build them in the heap)
+			const char* m_position;									///< Where the next item starts (null if unknown)
+			std::vector<SourceMap::Entry> m_located;				///< Offsets of the built items not recorded yet
+			std::vector<Item::Base::PointerType> m_open;			///< Containers being built (innermost last)
+			std::vector<std::size_t> m_packed_offsets;				///< Offsets of the values packed while building (innermost list last, when locating)
+
+			/**
+			 * Gets the container which is being filled
+			 * @return container
+			 */
+			Item::Container& 										Current() noexcept;
+
+			/**
+			 * Gets the container which is being filled, adding the values packed so far as items
+			 * @throw ItemAlreadyExists if a packed value is duplicated
+			 * @return container
+			 */
+			Item::Container& 										Target();
+
+			/**
+			 * Appends a value to the current list without creating an item for it (when packing values)
+			 * @param name value name (only unnamed values are packed)
+			 * @param value value
+			 * @return bool packed?
+			 */
+			template<typename T>
+			bool 													Pack(std::string_view name, const T& value) {
+				Item::Container& current = Current();
+				if (c_context.packs != PackMode::Values || !name.empty() || current.ContainerType() != Item::ContainerType::List || !static_cast<Item::List&>(current).Append(value))
+					return false;
+				if (c_context.map)
+					m_packed_offsets.push_back(Offset());
+				return true;
+			}
+
+			/**
+			 * Gets the offset of the next item
+			 * @return offset (npos if unknown)
+			 */
+			std::size_t 											Offset() const noexcept;
+
+			/**
+			 * Keeps the values packed while building a list if they are worth it
+			 * @param container built container
+			 * @throw ItemAlreadyExists if a packed value is duplicated
+			 */
+			void 													Seal(Item::Container& container);
+
+			/**
+			 * Adds the values packed while building a list as items (with their offsets)
+			 * @param list built list
+			 * @throw ItemAlreadyExists if a packed value is duplicated
+			 */
+			void 													Flush(Item::List& list);
+
+			/**
+			 * Creates an item in the leased resource (or in the heap when there is none)
+			 * @param args arguments for the item constructor
+			 * @return created item
+			 */
+			template<class T, class... Args>
+			std::shared_ptr<T> 										Make(Args&&... args) const {
+				if (m_lease)
+					return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(m_lease.get()), std::forward<Args>(args)...);
+				return std::make_shared<T>(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Creates a string item (or comment), viewing its text when it lies in the retained source
+			 * @param text item text
+			 * @return created item
+			 */
+			template<class T>
+			std::shared_ptr<T> 										MakeText(std::string_view text) const {
+				if (!IsRetained(text))
+					return Make<T>(std::string(text));
+				auto item = Make<T>(std::string());
+				static_cast<Item::Value<std::string>&>(*item).Borrow(text);
+				return item;
+			}
+
+			/**
+			 * Checks if text lies in the retained source
+			 * @param text text to check
+			 * @return bool retained?
+			 */
+			bool 													IsRetained(std::string_view text) const noexcept;
+
+			/**
+			 * Gets an item of a cached fragment for the tree being built
+			 *
+			 * Items are shared with the cache, except for string values with references and the
+			 * containers holding them, which are copied to be attached to this builder resolver.
+			 * Copies get the location of their original.
+			 * @param item cached item
+			 * @param sources sources the item was built from (null if not kept)
+			 * @return item to add
+			 */
+			Item::Base::PointerType 								Adopt(const Item::Base::PointerType& item, const Locations* sources) const;
+
+			/**
+			 * Keeps the offset of a built item
+			 * @param item built item
+			 */
+			void 													Record(const Item::Base::PointerType& item);
+
+			/**
+			 * Attaches a string value to the resolver if it has references
+			 * @param item string item
+			 */
+			void 													Attach(Item::Base& item) const;
+
+			/**
+			 * Names an item and adds it to current container
+			 * @param item item to add
+			 * @param name item name (empty for unnamed items)
+			 */
+			void 													Add(Item::Base::PointerType item, std::string_view name);
+	};
+}
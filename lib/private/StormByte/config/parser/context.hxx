@@ -0,0 +1,30 @@
+#pragma once
+
+#include <StormByte/config/item/interpolation.hxx>
+#include <StormByte/config/parser/arena.hxx>
+#include <StormByte/config/parser/locations.hxx>
+#include <StormByte/config/type.hxx>
+
+#include <memory>
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @struct Context
+	 * @brief What the items built from an input are attached to (and how they are built)
+	 */
+	struct STORMBYTE_CONFIG_PRIVATE Context {
+		std::shared_ptr<const Item::Resolver> resolver;				///< Resolver string values with references are attached to (if any)
+		std::shared_ptr<Locations> locations;						///< Sources of the configuration being built (if any)
+		std::shared_ptr<SourceMap> map;								///< Map of the source being parsed item offsets are recorded to (if any)
+		std::weak_ptr<Arena> arena;									///< Arena the items are built in (if any, weak as lazily parsed items hold a context too)
+		ListMode lists = ListMode::Unique;							///< How items are added to the built lists
+		PackMode packs = PackMode::Items;							///< How the built lists of plain values are stored
+		std::weak_ptr<Arena> sources;								///< Arena retaining the sources parsed strings view (strings are copied when null)
+		std::string_view source;									///< Retained source being parsed (empty if strings are copied)
+	};
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <StormByte/config/parser/context.hxx>
+#include <StormByte/config/parser/source.hxx>
+#include <StormByte/config/type.hxx>
+
+#include <memory>
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @struct Deferred
+	 * @brief Contents of a container which will be parsed on first access
+	 */
+	struct STORMBYTE_CONFIG_PRIVATE Deferred {
+		std::shared_ptr<const Source> source;						///< Retained source the contents point to
+		std::string_view body;										///< Container contents including its end character
+		unsigned int line;											///< Line number where the contents start
+		OnExistingAction action;									///< Action to take when item name already exists
+		OnCommentAction comments;									///< What to do with comments
+		std::shared_ptr<const std::filesystem::path> directory;		///< Directory relative includes are resolved from (null for working directory)
+		Context context;											///< What the built items are attached to
+	};
+}
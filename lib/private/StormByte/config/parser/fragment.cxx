@@ -0,0 +1,106 @@
+#include <StormByte/config/item/interpolation.hxx>
+#include <StormByte/config/parser/fragment.hxx>
+#include <StormByte/config/parser/parser.hxx>
+#include <StormByte/config/parser/source.hxx>
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+using namespace StormByte::Config::Parser;
+
+namespace {
+	thread_local std::vector<std::string> including;				///< Files being parsed by this thread (to detect cycles)
+	const auto c_placeholder = std::make_shared<const StormByte::Config::Item::Resolver>(nullptr);	///< Resolver without root the cached strings with references are attached to
+
+	/**
+	 * @struct IncludeGuard
+	 * @brief Marks a file as being parsed by this thread during its lifetime
+	 */
+	struct IncludeGuard {
+		IncludeGuard(const std::string& path) {
+			including.push_back(path);
+		}
+
+		~IncludeGuard() noexcept {
+			including.pop_back();
+		}
+	};
+}
+
+FragmentCache& FragmentCache::Instance() {
+	static FragmentCache cache;
+	return cache;
+}
+
+FragmentCache::Fragment FragmentCache::Get(const std::filesystem::path& path, const OnExistingAction& action, const OnCommentAction& comments, const ListMode& lists, const PackMode& packs, const bool& located, const bool& resolves) {
+	std::error_code error;
+	const std::filesystem::path canonical = std::filesystem::canonical(path, error);
+	if (error)
+		throw FileIOError(path.string(), error.message());
+	const auto modified = std::filesystem::last_write_time(canonical, error);
+	const std::uintmax_t size = error ? 0 : std::filesystem::file_size(canonical, error);
+	if (error)
+		throw FileIOError(path.string(), error.message());
+
+	const Key key { canonical.string(), action, comments, lists, packs, located, resolves };
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const auto it = m_entries.find(key);
+		if (it != m_entries.end() && it->second.modified == modified && it->second.size == size) {
+			it->second.used = ++m_tick;
+			return it->second.fragment;
+		}
+	}
+
+	if (std::find(including.begin(), including.end(), canonical.string()) != including.end())
+		throw Exception("Include cycle detected at " + canonical.string());
+
+	// Touched files with the same contents are not parsed again
+	Source source = Source::FromFile(canonical);
+	const std::size_t hash = std::hash<std::string_view>()(source.View());
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const auto it = m_entries.find(key);
+		if (it != m_entries.end() && it->second.size == size && it->second.hash == hash) {
+			it->second.modified = modified;
+			it->second.used = ++m_tick;
+			return it->second.fragment;
+		}
+	}
+
+	// Mutex is not held while parsing so nested includes can use the cache
+	auto group = std::make_shared<Item::Group>();
+	auto locations = located ? std::make_shared<Locations>() : nullptr;
+	{
+		const IncludeGuard guard(canonical.string());
+		auto res = Parser::Parse(std::move(source), *group, action, comments, Context { resolves ? c_placeholder : nullptr, locations, nullptr, {}, lists, packs, {}, {} }, ParseMode::Eager, {}, {}, {});
+		if (!res)
+			throw *res.error();
+	}
+
+	const Fragment fragment { std::move(group), std::move(locations) };
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Store(key, Entry { modified, size, hash, fragment, ++m_tick });
+	return fragment;
+}
+
+void FragmentCache::Clear() noexcept {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_entries.clear();
+}
+
+void FragmentCache::Store(const Key& key, Entry&& entry) {
+	// Entries of the same file parsed with other settings are outdated if it changed
+	std::erase_if(m_entries, [&key, &entry](const auto& cached) {
+		return std::get<0>(cached.first) == std::get<0>(key) && (cached.second.modified != entry.modified || cached.second.size != entry.size);
+	});
+	m_entries.insert_or_assign(key, std::move(entry));
+	if (m_entries.size() > c_capacity) {
+		const auto oldest = std::min_element(m_entries.begin(), m_entries.end(), [](const auto& first, const auto& second) {
+			return first.second.used < second.second.used;
+		});
+		m_entries.erase(oldest);
+	}
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <StormByte/config/item/group.hxx>
+#include <StormByte/config/parser/locations.hxx>
+#include <StormByte/config/type.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class FragmentCache
+	 * @brief Process wide cache of parsed included files
+	 *
+	 * Entries are keyed by canonical path and parse settings, and are reused while the file
+	 * keeps its modification time and size or, when those changed, its contents hash.
+	 * Entries of a changed file are dropped once it is parsed again, and only the most
+	 * recently used ones are kept. Cached groups are never modified so they can be shared
+	 * between threads, and their items are shared by the includers (see Item::Container).
+	 */
+	class STORMBYTE_CONFIG_PRIVATE FragmentCache {
+		public:
+			/**
+			 * @struct Fragment
+			 * @brief Parsed file
+			 */
+			struct Fragment {
+				std::shared_ptr<const Item::Group> group;			///< Parsed items (they must not be modified)
+				std::shared_ptr<const Locations> locations;			///< Where the items were read from (null if not kept)
+			};
+
+			/**
+			 * Copy constructor
+			 */
+			FragmentCache(const FragmentCache&) 					= delete;
+
+			/**
+			 * Move constructor
+			 */
+			FragmentCache(FragmentCache&&) 							= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			FragmentCache& operator=(const FragmentCache&) 			= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			FragmentCache& operator=(FragmentCache&&) 				= delete;
+
+			/**
+			 * Destructor
+			 */
+			~FragmentCache() noexcept 								= default;
+
+			/**
+			 * Gets the process wide cache
+			 * @return cache
+			 */
+			static FragmentCache& 									Instance();
+
+			/**
+			 * Gets a parsed file, parsing it only if it is not cached or it changed
+			 * @param path file path
+			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param lists how items are added to lists
+			 * @param packs how lists of plain values are stored
+			 * @param located keep where the items are read from?
+			 * @param resolves attach string values with references (so includers find them)?
+			 * @throw FileIOError if file can not be read
+			 * @throw ParseError if file contents can not be parsed
+			 * @throw Exception if file is already being included (include cycle)
+			 * @return parsed file
+			 */
+			Fragment 												Get(const std::filesystem::path& path, const OnExistingAction& action, const OnCommentAction& comments, const ListMode& lists, const PackMode& packs, const bool& located, const bool& resolves);
+
+			/**
+			 * Drops every cached file (includers keep the items they share with it)
+			 */
+			void 													Clear() noexcept;
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief Cached parsed file
+			 */
+			struct Entry {
+				std::filesystem::file_time_type modified;			///< File modification time when parsed
+				std::uintmax_t size;								///< File size when parsed
+				std::size_t hash;									///< File contents hash
+				Fragment fragment;									///< Parsed file
+				std::uint64_t used;									///< Tick of its last use
+			};
+
+			using Key = std::tuple<std::string, OnExistingAction, OnCommentAction, ListMode, PackMode, bool, bool>;
+
+			static constexpr std::size_t c_capacity = 256;			///< Number of entries kept (least recently used ones are dropped)
+			std::map<Key, Entry> m_entries;							///< Cached files
+			std::uint64_t m_tick = 0;								///< Uses so far
+			std::mutex m_mutex;										///< Mutex for the entries (not held while parsing)
+
+			/**
+			 * Constructor
+			 */
+			FragmentCache() noexcept 								= default;
+
+			/**
+			 * Stores a parsed file, dropping outdated and least recently used entries (mutex must be held)
+			 * @param key entry key
+			 * @param entry parsed file
+			 */
+			void 													Store(const Key& key, Entry&& entry);
+	};
+}
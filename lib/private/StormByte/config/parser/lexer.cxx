@@ -0,0 +1,199 @@
+#include <StormByte/config/parser/lexer.hxx>
+#include <StormByte/config/parser/scanner.hxx>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using namespace StormByte::Config::Parser;
+
+Lexer::Lexer(std::string_view buffer, const unsigned int& line) noexcept:
+m_begin(buffer.data()), m_current(buffer.data()), m_end(buffer.data() + buffer.size()), m_counted(buffer.data()), m_counted_line(line) {}
+
+unsigned int Lexer::Line(const std::size_t& offset) const noexcept {
+	// Line breaks are only counted when asked for, from the last position they were counted up to
+	const char* position = m_begin + offset;
+	if (position >= m_counted)
+		m_counted_line += static_cast<unsigned int>(Scanner::Count(m_counted, position, '\n'));
+	else
+		m_counted_line -= static_cast<unsigned int>(Scanner::Count(position, m_counted, '\n'));
+	m_counted = position;
+	return m_counted_line;
+}
+
+void Lexer::ConsumeWS() noexcept {
+	while (m_current != m_end) {
+		switch(*m_current) {
+			case '\n':
+			case ' ':
+			case '\t':
+			case '\r':
+				m_current++;
+				continue;
+			default:
+				return;
+		}
+	}
+}
+
+std::string_view Lexer::GetStringIgnoringWS() noexcept {
+	ConsumeWS();
+	const char* start = m_current;
+	while (m_current != m_end) {
+		switch(*m_current) {
+			case '\n':
+			case ' ':
+			case '\t':
+			case '\r':
+				return std::string_view(start, static_cast<std::size_t>(m_current - start));
+			default:
+				m_current++;
+				continue;
+		}
+	}
+	return std::string_view(start, static_cast<std::size_t>(m_current - start));
+}
+
+CommentType Lexer::FindComment() noexcept {
+	ConsumeWS();
+	switch(Peek()) {
+		case '#':
+			m_current++;
+			return CommentType::SingleLineBash;
+		case '/':
+			switch(PeekNext()) {
+				case '*':
+					m_current += 2;
+					return CommentType::MultiLineC;
+				case '/':
+					m_current += 2;
+					return CommentType::SingleLineC;
+				default:
+					return CommentType::None;
+			}
+		default:
+			return CommentType::None;
+	}
+}
+
+bool Lexer::FindContainerEnd(const char& end) noexcept {
+	ConsumeWS();
+	if (m_current != m_end && *m_current == end) {
+		m_current++;
+		return true;
+	}
+	return false;
+}
+
+std::string_view Lexer::GetLine() noexcept {
+	const char* start = m_current;
+	m_current = Scanner::Find(m_current, m_end, '\n', '\n');
+	std::string_view line(start, static_cast<std::size_t>(m_current - start));
+	if (m_current != m_end)
+		m_current++;
+	return line;
+}
+
+bool Lexer::GetUntil(std::string_view delimiter, std::string_view& contents) noexcept {
+	const char* start = m_current;
+	const std::size_t tail_size = delimiter.size() - 1;
+	const char* found = Scanner::Find(m_current, m_end, delimiter[0], delimiter[0]);
+	// Candidates are found by their first character and then the rest is checked
+	while (found != m_end && (static_cast<std::size_t>(m_end - found) <= tail_size || std::memcmp(found + 1, delimiter.data() + 1, tail_size) != 0))
+		found = Scanner::Find(found + 1, m_end, delimiter[0], delimiter[0]);
+
+	contents = std::string_view(start, static_cast<std::size_t>(found - start));
+	if (found == m_end) {
+		m_current = m_end;
+		return false;
+	}
+	m_current = found + delimiter.size();
+	return true;
+}
+
+std::string_view Lexer::GetUntilAnyOf(const char& first, const char& second) noexcept {
+	const char* start = m_current;
+	m_current = Scanner::Find(m_current, m_end, first, second);
+	return std::string_view(start, static_cast<std::size_t>(m_current - start));
+}
+
+bool Lexer::SkipContainer(const char& end) {
+	// Expected closing characters, innermost last
+	std::string pending(1, end);
+	enum class Within { Code, String, LineComment, BlockComment } within = Within::Code;
+	// Structural characters before this position are already handled (escaped or second of a pair)
+	const char* handled = m_current;
+
+	// Only structural characters are visited, 64 bytes are classified at once
+	for (const char* block = m_current; block < m_end; block += 64) {
+		for (std::uint64_t mask = Scanner::StructuralMask(block, m_end); mask; mask &= mask - 1) {
+			const char* position = block + std::countr_zero(mask);
+			const char c = *position;
+			if (c == '\n') {
+				if (within == Within::LineComment)
+					within = Within::Code;
+				continue;
+			}
+			if (position < handled)
+				continue;
+
+			const char next = position + 1 < m_end ? position[1] : '\0';
+			switch (within) {
+				case Within::Code:
+					switch (c) {
+						case '{':
+							pending += '}';
+							break;
+						case '[':
+							pending += ']';
+							break;
+						case '}':
+						case ']':
+							if (c != pending.back()) {
+								m_current = position;
+								return false;
+							}
+							pending.pop_back();
+							if (pending.empty()) {
+								m_current = position + 1;
+								return true;
+							}
+							break;
+						case '"':
+							within = Within::String;
+							break;
+						case '#':
+							within = Within::LineComment;
+							break;
+						case '/':
+							if (next == '/')
+								within = Within::LineComment;
+							else if (next == '*')
+								within = Within::BlockComment;
+							handled = position + 2;
+							break;
+						default:
+							break;
+					}
+					break;
+				case Within::String:
+					if (c == '\\')
+						handled = position + 2;
+					else if (c == '"')
+						within = Within::Code;
+					break;
+				case Within::BlockComment:
+					if (c == '*' && next == '/') {
+						within = Within::Code;
+						handled = position + 2;
+					}
+					break;
+				case Within::LineComment:
+					break;
+			}
+		}
+	}
+	m_current = m_end;
+	return false;
+}
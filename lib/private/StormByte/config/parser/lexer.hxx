@@ -0,0 +1,193 @@
+#pragma once
+
+#include <StormByte/config/parser/type.hxx>
+#include <StormByte/config/visibility.h>
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class Lexer
+	 * @brief Scans a contiguous character buffer by pointer advancement
+	 *
+	 * The lexer does not own the buffer, so it has to outlive the lexer. Line breaks
+	 * are not tracked while scanning, the current line is counted only when asked for.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Lexer {
+		public:
+			/**
+			 * Constructor
+			 * @param buffer buffer to scan
+			 * @param line line number where the buffer starts
+			 */
+			Lexer(std::string_view buffer, const unsigned int& line = 1) noexcept;
+
+			/**
+			 * Copy constructor
+			 * @param lexer lexer to copy
+			 */
+			Lexer(const Lexer& lexer) 								= default;
+
+			/**
+			 * Move constructor
+			 * @param lexer lexer to move
+			 */
+			Lexer(Lexer&& lexer) noexcept 							= default;
+
+			/**
+			 * Assignment operator
+			 * @param lexer lexer to copy
+			 */
+			Lexer& operator=(const Lexer& lexer) 					= default;
+
+			/**
+			 * Move assignment operator
+			 * @param lexer lexer to move
+			 */
+			Lexer& operator=(Lexer&& lexer) noexcept 				= default;
+
+			/**
+			 * Destructor
+			 */
+			~Lexer() noexcept 										= default;
+
+			/**
+			 * Checks if the end of the buffer was reached
+			 * @return bool end reached?
+			 */
+			constexpr bool 											EoF() const noexcept {
+				return m_current == m_end;
+			}
+
+			/**
+			 * Gets the current character without consuming it
+			 * @return current character or '\0' when at the end of the buffer
+			 */
+			constexpr char 											Peek() const noexcept {
+				return m_current == m_end ? '\0' : *m_current;
+			}
+
+			/**
+			 * Gets the character after the current one without consuming anything
+			 * @return next character or '\0' when not available
+			 */
+			constexpr char 											PeekNext() const noexcept {
+				return m_end - m_current < 2 ? '\0' : m_current[1];
+			}
+
+			/**
+			 * Consumes current character (if any)
+			 */
+			constexpr void 											Skip() noexcept {
+				if (m_current != m_end)
+					m_current++;
+			}
+
+			/**
+			 * Gets current line (counting the line breaks since the last time it was asked for)
+			 * @return line number
+			 */
+			inline unsigned int 									Line() const noexcept {
+				return Line(Position());
+			}
+
+			/**
+			 * Gets the line at an offset from buffer start (counting the line breaks since the last time a line was asked for)
+			 * @param offset offset (not past the buffer end)
+			 * @return line number
+			 */
+			unsigned int 											Line(const std::size_t& offset) const noexcept;
+
+			/**
+			 * Gets the buffer start
+			 * @return buffer start
+			 */
+			constexpr const char* 									Begin() const noexcept {
+				return m_begin;
+			}
+
+			/**
+			 * Gets the current offset from buffer start
+			 * @return offset
+			 */
+			constexpr std::size_t 									Position() const noexcept {
+				return static_cast<std::size_t>(m_current - m_begin);
+			}
+
+			/**
+			 * Gets the remaining (not yet consumed) buffer
+			 * @return remaining buffer
+			 */
+			constexpr std::string_view 								Remaining() const noexcept {
+				return std::string_view(m_current, static_cast<std::size_t>(m_end - m_current));
+			}
+
+			/**
+			 * Consumes whitespace (and tabs, newline, etc)
+			 */
+			void 													ConsumeWS() noexcept;
+
+			/**
+			 * Gets the next whitespace delimited token ignoring leading whitespace
+			 * @return view of the token (empty if end of buffer is reached)
+			 */
+			std::string_view 										GetStringIgnoringWS() noexcept;
+
+			/**
+			 * Finds a comment start, consuming its opening characters
+			 * @return comment type (None if no comment is found and nothing is consumed)
+			 */
+			CommentType 											FindComment() noexcept;
+
+			/**
+			 * Finds the container end symbol, consuming it
+			 * @param end container end character
+			 * @return bool found?
+			 */
+			bool 													FindContainerEnd(const char& end) noexcept;
+
+			/**
+			 * Reads the rest of the current line, consuming the line break
+			 * @return view of the line (without line break)
+			 */
+			std::string_view 										GetLine() noexcept;
+
+			/**
+			 * Reads until the given delimiter sequence, consuming it
+			 * @param delimiter sequence to find
+			 * @param contents view of the contents found before delimiter
+			 * @return bool delimiter found?
+			 */
+			bool 													GetUntil(std::string_view delimiter, std::string_view& contents) noexcept;
+
+			/**
+			 * Advances until one of the given characters is found (without consuming it)
+			 * @param first first character to find
+			 * @param second second character to find
+			 * @return view of the skipped characters
+			 */
+			std::string_view 										GetUntilAnyOf(const char& first, const char& second) noexcept;
+
+			/**
+			 * Skips the rest of a container by bracket matching, consuming its end character
+			 *
+			 * Strings and comments are honored so brackets inside them are not counted but
+			 * nothing else is validated.
+			 * @param end container end character
+			 * @return bool container end found? (false on EOF or mismatched brackets)
+			 */
+			bool 													SkipContainer(const char& end);
+
+		private:
+			const char* m_begin;									///< Buffer start
+			const char* m_current;									///< Current position
+			const char* m_end;										///< Buffer end
+			mutable const char* m_counted;							///< Position line breaks are counted up to
+			mutable unsigned int m_counted_line;					///< Line at the counted position
+	};
+}
@@ -0,0 +1,110 @@
+#include <StormByte/config/parser/locations.hxx>
+#include <StormByte/config/parser/scanner.hxx>
+
+#include <algorithm>
+#include <iterator>
+
+using namespace StormByte::Config::Parser;
+
+SourceMap::SourceMap(std::shared_ptr<const Source> source) noexcept:m_source(std::move(source)) {}
+
+void SourceMap::Record(std::vector<Entry>& entries) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_entries.empty())
+		m_entries = std::move(entries);
+	else
+		std::move(entries.begin(), entries.end(), std::back_inserter(m_entries));
+	entries.clear();
+	if (m_entries.size() >= m_prune_at)
+		PruneLocked();
+}
+
+std::optional<std::size_t> SourceMap::Offset(const Item::Base& item) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return OffsetLocked(item);
+}
+
+std::optional<StormByte::Config::Location> SourceMap::Find(const Item::Base& item) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const auto offset = OffsetLocked(item);
+	if (!offset)
+		return std::nullopt;
+
+	const std::string_view contents = m_source->View();
+	if (m_line_starts.empty()) {
+		m_line_starts.push_back(0);
+		const char* end = contents.data() + contents.size();
+		for (const char* position = Scanner::Find(contents.data(), end, '\n', '\n'); position != end; position = Scanner::Find(position + 1, end, '\n', '\n'))
+			m_line_starts.push_back(static_cast<std::size_t>(position - contents.data()) + 1);
+	}
+	const auto line = std::prev(std::upper_bound(m_line_starts.begin(), m_line_starts.end(), *offset));
+	return Location {
+		m_source->Path(),
+		static_cast<unsigned int>(std::distance(m_line_starts.begin(), line)) + 1,
+		static_cast<unsigned int>(*offset - *line) + 1,
+		*offset
+	};
+}
+
+std::optional<std::size_t> SourceMap::OffsetLocked(const Item::Base& item) const {
+	// Entries recorded since the last query are indexed (later ones win for the same address)
+	for (; m_indexed < m_entries.size(); m_indexed++) {
+		if (const auto item_pointer = m_entries[m_indexed].item.lock())
+			m_index[item_pointer.get()] = m_indexed;
+	}
+	const auto it = m_index.find(&item);
+	// Items alive at the same time have different addresses, so a live entry is this item
+	if (it == m_index.end() || m_entries[it->second].item.expired())
+		return std::nullopt;
+	return m_entries[it->second].offset;
+}
+
+void SourceMap::PruneLocked() noexcept {
+	std::erase_if(m_entries, [](const Entry& entry) {
+		return entry.item.expired();
+	});
+	// Positions changed, so the entries are indexed again when asked for
+	m_index.clear();
+	m_indexed = 0;
+	m_prune_at = std::max(c_prune_threshold, m_entries.size() * 2);
+}
+
+std::shared_ptr<SourceMap> Locations::Open(std::shared_ptr<const Source> source) {
+	auto map = std::make_shared<SourceMap>(std::move(source));
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_maps.push_back(map);
+	return map;
+}
+
+void Locations::Add(const std::shared_ptr<SourceMap>& map) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (std::find(m_maps.begin(), m_maps.end(), map) == m_maps.end())
+		m_maps.push_back(map);
+}
+
+void Locations::Add(const Locations& locations) {
+	if (&locations == this)
+		return;
+	std::vector<std::shared_ptr<SourceMap>> maps;
+	{
+		std::lock_guard<std::mutex> lock(locations.m_mutex);
+		maps = locations.m_maps;
+	}
+	for (const auto& map: maps)
+		Add(map);
+}
+
+std::shared_ptr<SourceMap> Locations::Holding(const Item::Base& item) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	// Latest sources first as their items replace older ones
+	for (auto it = m_maps.rbegin(); it != m_maps.rend(); it++) {
+		if ((*it)->Offset(item))
+			return *it;
+	}
+	return nullptr;
+}
+
+std::optional<StormByte::Config::Location> Locations::Find(const Item::Base& item) const {
+	const auto map = Holding(item);
+	return map ? map->Find(item) : std::nullopt;
+}
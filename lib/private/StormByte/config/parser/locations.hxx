@@ -0,0 +1,197 @@
+#pragma once
+
+#include <StormByte/config/item/base.hxx>
+#include <StormByte/config/location.hxx>
+#include <StormByte/config/parser/source.hxx>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class SourceMap
+	 * @brief Offsets of the items built from a source
+	 *
+	 * Items are recorded by a weak pointer along with their offset while parsing. The items
+	 * are indexed by address and the line breaks of the source are found the first time a
+	 * location is asked for, and it is safe to record and ask from several threads. An entry
+	 * whose item is gone is never reported, even if a later item got its address, and such
+	 * entries are dropped once the map doubled its entries since they were last dropped (so
+	 * the memory of items allocated along with their reference count is released too).
+	 */
+	class STORMBYTE_CONFIG_PRIVATE SourceMap {
+		public:
+			/**
+			 * @struct Entry
+			 * @brief Recorded item
+			 */
+			struct Entry {
+				std::weak_ptr<const Item::Base> item;				///< Item (expired once destroyed)
+				std::size_t offset;									///< Offset from the start of the source
+			};
+
+			/**
+			 * Constructor
+			 * @param source source the items are built from (it is retained)
+			 */
+			explicit SourceMap(std::shared_ptr<const Source> source) noexcept;
+
+			/**
+			 * Copy constructor
+			 */
+			SourceMap(const SourceMap&) 							= delete;
+
+			/**
+			 * Move constructor
+			 */
+			SourceMap(SourceMap&&) 									= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			SourceMap& operator=(const SourceMap&) 					= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			SourceMap& operator=(SourceMap&&) 						= delete;
+
+			/**
+			 * Destructor
+			 */
+			~SourceMap() noexcept 									= default;
+
+			/**
+			 * Gets the source contents
+			 * @return view of the contents
+			 */
+			inline std::string_view 								View() const noexcept {
+				return m_source->View();
+			}
+
+			/**
+			 * Appends entries
+			 * @param entries entries to append (they are moved)
+			 */
+			void 													Record(std::vector<Entry>& entries);
+
+			/**
+			 * Gets the offset an item was recorded with
+			 * @param item item to find
+			 * @return offset (if recorded)
+			 */
+			std::optional<std::size_t> 								Offset(const Item::Base& item) const;
+
+			/**
+			 * Gets the location an item was recorded with
+			 * @param item item to find
+			 * @return location (if recorded)
+			 */
+			std::optional<Location> 								Find(const Item::Base& item) const;
+
+		private:
+			static constexpr std::size_t c_prune_threshold = 1024;	///< Number of entries from which the ones of destroyed items are dropped
+
+			const std::shared_ptr<const Source> m_source;			///< Source the items are built from
+			mutable std::mutex m_mutex;								///< Mutex for the entries and indexes
+			std::vector<Entry> m_entries;							///< Recorded items
+			mutable std::unordered_map<const Item::Base*, std::size_t> m_index;	///< Entry position by item address (of the indexed entries)
+			mutable std::size_t m_indexed = 0;						///< Number of entries indexed
+			std::size_t m_prune_at = c_prune_threshold;				///< Number of entries at which the ones of destroyed items are dropped
+			mutable std::vector<std::size_t> m_line_starts;			///< Offsets where lines start (empty until needed)
+
+			/**
+			 * Gets the offset an item was recorded with (mutex must be held)
+			 * @param item item to find
+			 * @return offset (if recorded)
+			 */
+			std::optional<std::size_t> 								OffsetLocked(const Item::Base& item) const;
+
+			/**
+			 * Drops the entries of destroyed items (mutex must be held)
+			 */
+			void 													PruneLocked() noexcept;
+	};
+
+	/**
+	 * @class Locations
+	 * @brief Sources the items of a configuration were built from
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Locations {
+		public:
+			/**
+			 * Constructor
+			 */
+			Locations() noexcept 									= default;
+
+			/**
+			 * Copy constructor
+			 */
+			Locations(const Locations&) 							= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Locations(Locations&&) 									= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			Locations& operator=(const Locations&) 					= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Locations& operator=(Locations&&) 						= delete;
+
+			/**
+			 * Destructor
+			 */
+			~Locations() noexcept 									= default;
+
+			/**
+			 * Adds a map for a new source
+			 * @param source source being parsed
+			 * @return map to record its items to
+			 */
+			std::shared_ptr<SourceMap> 								Open(std::shared_ptr<const Source> source);
+
+			/**
+			 * Adds a map of another configuration (like an included fragment) unless already added
+			 * @param map map to add
+			 */
+			void 													Add(const std::shared_ptr<SourceMap>& map);
+
+			/**
+			 * Adds the maps of another configuration (like an included fragment) unless already added
+			 * @param locations sources of the other configuration
+			 */
+			void 													Add(const Locations& locations);
+
+			/**
+			 * Gets the map an item was recorded to
+			 * @param item item to find
+			 * @return map (null if not recorded)
+			 */
+			std::shared_ptr<SourceMap> 								Holding(const Item::Base& item) const;
+
+			/**
+			 * Gets the location an item was recorded with
+			 * @param item item to find
+			 * @return location (if recorded)
+			 */
+			std::optional<Location> 								Find(const Item::Base& item) const;
+
+		private:
+			mutable std::mutex m_mutex;								///< Mutex for the maps
+			std::vector<std::shared_ptr<SourceMap>> m_maps;			///< Maps of every source
+	};
+}
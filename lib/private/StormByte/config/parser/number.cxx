@@ -0,0 +1,85 @@
+#include <StormByte/config/parser/number.hxx>
+
+#include <charconv>
+#include <system_error>
+
+#ifndef __cpp_lib_to_chars
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#endif
+
+namespace StormByte::Config::Parser {
+	/**
+	 * Skips consecutive digits
+	 * @param current position to start from (updated)
+	 * @param end end of text
+	 * @return bool was at least one digit found?
+	 */
+	static bool SkipDigits(const char*& current, const char* end) noexcept {
+		const char* start = current;
+		while (current != end && *current >= '0' && *current <= '9')
+			current++;
+		return current != start;
+	}
+
+	ConversionResult ToNumber(std::string_view token, int& value) noexcept {
+		const char* current = token.data();
+		const char* end = current + token.size();
+		// std::from_chars does not accept an explicit + sign
+		if (current != end && *current == '+')
+			current++;
+		const char* number_start = current;
+		if (current != end && *current == '-' && current == token.data())
+			current++;
+		if (!SkipDigits(current, end) || current != end)
+			return ConversionResult::Invalid;
+
+		const auto [ptr, ec] = std::from_chars(number_start, end, value);
+		if (ec == std::errc::result_out_of_range)
+			return ConversionResult::OutOfRange;
+		return ec == std::errc() && ptr == end ? ConversionResult::Success : ConversionResult::Invalid;
+	}
+
+	ConversionResult ToNumber(std::string_view token, double& value) noexcept {
+		const char* current = token.data();
+		const char* end = current + token.size();
+		if (current != end && *current == '+')
+			current++;
+		const char* number_start = current;
+		if (current != end && *current == '-' && current == token.data())
+			current++;
+		if (!SkipDigits(current, end))
+			return ConversionResult::Invalid;
+		if (current != end && *current == '.') {
+			current++;
+			if (!SkipDigits(current, end))
+				return ConversionResult::Invalid;
+		}
+		if (current != end && (*current == 'e' || *current == 'E')) {
+			current++;
+			if (current != end && (*current == '+' || *current == '-'))
+				current++;
+			if (!SkipDigits(current, end))
+				return ConversionResult::Invalid;
+		}
+		if (current != end)
+			return ConversionResult::Invalid;
+
+		#ifdef __cpp_lib_to_chars
+		const auto [ptr, ec] = std::from_chars(number_start, end, value);
+		if (ec == std::errc::result_out_of_range)
+			return ConversionResult::OutOfRange;
+		return ec == std::errc() && ptr == end ? ConversionResult::Success : ConversionResult::Invalid;
+		#else
+		// Standard libraries without floating point std::from_chars: the text is already validated
+		const std::string number(number_start, end);
+		errno = 0;
+		const double result = std::strtod(number.c_str(), nullptr);
+		if (errno == ERANGE)
+			return ConversionResult::OutOfRange;
+		value = result;
+		return ConversionResult::Success;
+		#endif
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <StormByte/config/parser/type.hxx>
+#include <StormByte/config/visibility.h>
+
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * Converts a token to integer
+	 *
+	 * Accepted format is an optional sign followed by digits and nothing else
+	 * @param token text to convert
+	 * @param value converted value (only written on success)
+	 * @return conversion result
+	 */
+	ConversionResult STORMBYTE_CONFIG_PRIVATE 						ToNumber(std::string_view token, int& value) noexcept;
+
+	/**
+	 * Converts a token to double
+	 *
+	 * Accepted format is an optional sign followed by digits, an optional decimal part
+	 * and an optional exponent (with optional sign) and nothing else
+	 * @param token text to convert
+	 * @param value converted value (only written on success)
+	 * @return conversion result
+	 */
+	ConversionResult STORMBYTE_CONFIG_PRIVATE 						ToNumber(std::string_view token, double& value) noexcept;
+}
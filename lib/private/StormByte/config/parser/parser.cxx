@@ -1,24 +1,83 @@
+#include <StormByte/config/parser/lexer.hxx>
+#include <StormByte/config/parser/number.hxx>
 #include <StormByte/config/parser/parser.hxx>
 
-#include <sstream>
+#include <StormByte/config/parser/pool.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 
 using namespace StormByte::Config::Parser;
 
-const std::regex Parser::c_double_regex(R"(^[+-]?\d+(\.\d+)?([eE][+-]?\d+)?$)");
-const std::regex Parser::c_int_regex(R"(^[+-]?\d+$)");
+namespace {
+	constexpr std::size_t c_parallel_threshold = 1024 * 1024;	///< Inputs smaller than this are not worth splitting
+}
+
+Parser::Parser(Reader&& reader, Handler& handler):
+m_reader(std::move(reader)), m_handler(handler), m_builder(nullptr), m_deferring_builder(nullptr) {}
+
+Parser::Parser(Reader&& reader, Builder& builder):
+m_reader(std::move(reader)), m_handler(builder), m_builder(&builder), m_deferring_builder(nullptr) {}
+
+Parser::Parser(Reader&& reader, Builder& builder, std::shared_ptr<const Source> retained):
+m_reader(std::move(reader)), m_handler(builder), m_builder(&builder), m_deferring_builder(&builder), m_retained(std::move(retained)) {}
+
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::istream& istream, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+	// Read the whole stream once so the lexer can work over a contiguous buffer
+	std::string buffer { std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>() };
+	return Parse(Source(std::move(buffer)), root, action, comments, context, mode, before, after, on_failure);
+}
+
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::string_view buffer, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+	// Caller buffer may not outlive unparsed containers, item locations nor viewing strings so it is copied for them
+	if (mode == ParseMode::Lazy || context.locations || !context.sources.expired())
+		return Parse(Source(std::string(buffer)), root, action, comments, context, mode, before, after, on_failure);
+	return Build(buffer, nullptr, nullptr, root, action, comments, context, mode, before, after, on_failure);
+}
 
-Parser::Parser(const OnExistingAction& action):
-m_container_level(0), m_current_line(1), c_on_existing_action(action) {}
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(Source&& source, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+	auto directory = source.Directory();
+	const auto keeper = context.sources.lock();
+	if (mode != ParseMode::Lazy && !context.locations && !keeper)
+		return Build(source.View(), nullptr, std::move(directory), root, action, comments, context, mode, before, after, on_failure);
+
+	// Source is retained by lazily parsed containers, by the map of item locations and by the arena of viewing strings
+	auto retained = std::make_shared<const Source>(std::move(source));
+	const std::string_view buffer = retained->View();
+	Context located = context;
+	if (context.locations)
+		located.map = context.locations->Open(retained);
+	if (keeper) {
+		keeper->Retain(retained);
+		located.source = buffer;
+	}
+	return Build(buffer, mode == ParseMode::Lazy ? std::move(retained) : nullptr, std::move(directory), root, action, comments, located, mode, before, after, on_failure);
+}
 
-StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::istream& istream, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
-	// Create parser
-	Parser parser(action);
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Materialize(const Deferred& deferred, Item::Container& container, const bool& defer_nested) {
+	Builder builder(container, deferred.action, deferred.comments, deferred.directory, deferred.context);
+	Reader reader(deferred.body, container.ContainerType(), deferred.line);
+	if (defer_nested)
+		return Parser(std::move(reader), builder, deferred.source).Dispatch();
+	return Parser(std::move(reader), builder).Dispatch();
+}
 
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Build(std::string_view buffer, std::shared_ptr<const Source> retained, std::shared_ptr<const std::filesystem::path> directory, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
 	// Execute before hooks
 	for (const auto& hook: before)
 		hook(root);
-	auto res = parser.Parse(istream, root, Mode::Named);
-	
+
+	Expected<void, ParseError> res;
+	if (mode != ParseMode::Parallel || !BuildParallel(buffer, directory, root, action, comments, context)) {
+		// Item tree is just another consumer of the parse events
+		Builder builder(root, action, comments, std::move(directory), context);
+		res = retained ? Parser(Reader(buffer), builder, std::move(retained)).Dispatch() : Parser(Reader(buffer), builder).Dispatch();
+	}
+	return Conclude(std::move(res), root, after, on_failure);
+}
+
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Conclude(Expected<void, ParseError>&& res, Item::Group& root, const HookFunctions& after, const OptionalFailureHook& on_failure) {
 	if (!res) {
 		bool should_throw = true;
 		if (on_failure)
@@ -35,483 +94,279 @@ StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::istr
 	return {};
 }
 
-StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(const std::string& string, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
-	std::istringstream istream(string);
-	return Parse(istream, root, action, before, after, on_failure);
-}
+bool Parser::BuildParallel(std::string_view buffer, const std::shared_ptr<const std::filesystem::path>& directory, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context) {
+	ThreadPool& pool = ThreadPool::Default();
+	if (buffer.size() < c_parallel_threshold || pool.Concurrency() < 2)
+		return false;
 
-template<> StormByte::Expected<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::MultiLineC>, StormByte::Config::ParseError> Parser::ParseValue<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::MultiLineC>>(std::istream& istream) {
-	bool comment_closed = false;
-	char c;
-	std::string buffer;
-	while (!comment_closed && istream.get(c)) {
-		switch(c) {
-			case '*':
-				if (istream.peek() == '/') {
-					comment_closed = true;
-					istream.get(c);
-				}
-				else
-					buffer += c;
-				break;
-			case '\n':
-				m_current_line++;
-				[[fallthrough]];
-			default:
-				buffer += c;
-				break;
+	Item::Group skeleton;
+	std::vector<Item::Container*> tasks;
+	try {
+		// Stage 1: top level items with containers only bracket matched
+		Builder builder(skeleton, action, comments, directory, context);
+		if (!Parser(Reader(buffer), builder, nullptr).Dispatch())
+			return false;
+
+		// Containers bigger than a share of the input are split into their children (a huge list, for example)
+		const std::size_t share = buffer.size() / (pool.Concurrency() * 4);
+		std::vector<Item::Container*> pending;
+		FindDeferred(skeleton, pending);
+		while (!pending.empty()) {
+			Item::Container* container = pending.back();
+			pending.pop_back();
+			if (container->m_deferred->body.size() > share) {
+				if (!Materialize(*container, true))
+					return false;
+				FindDeferred(*container, pending);
+			}
+			else
+				tasks.push_back(container);
 		}
 	}
+	catch (const StormByte::Exception&) {
+		return false;
+	}
 
-	if (!comment_closed || istream.eof() || istream.fail())
-		return Unexpected<ParseError>(m_current_line, "Unclosed MultiLineC comment");
-
-	return Item::Comment<Item::CommentType::MultiLineC>(std::move(buffer));
-}
+	// Stage 2: biggest first for a better balance
+	std::sort(tasks.begin(), tasks.end(), [](const Item::Container* a, const Item::Container* b) {
+		return a->m_deferred->body.size() > b->m_deferred->body.size();
+	});
+	std::atomic<bool> failed = false;
+	pool.ForEach(tasks.size(), [&tasks, &failed](std::size_t index) {
+		try {
+			if (!Materialize(*tasks[index], false))
+				failed = true;
+		}
+		catch (...) {
+			failed = true;
+		}
+	});
+	if (failed)
+		return false;
 
-template<> StormByte::Expected<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::SingleLineBash>, StormByte::Config::ParseError> Parser::ParseValue<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::SingleLineBash>>(std::istream& istream) {
-	std::string line;
-	std::getline(istream, line);
-	m_current_line++;
-	return Item::Comment<Item::CommentType::SingleLineBash>(std::move(line));
+	for (auto& item: skeleton.Items())
+		root.Insert(std::move(item), action);
+	return true;
 }
 
-template<> StormByte::Expected<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::SingleLineC>, StormByte::Config::ParseError> Parser::ParseValue<StormByte::Config::Item::Comment<StormByte::Config::Item::CommentType::SingleLineC>>(std::istream& istream) {
-	std::string line;
-	std::getline(istream, line);
-	m_current_line++;
-	return Item::Comment<Item::CommentType::SingleLineC>(std::move(line));
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Materialize(Item::Container& container, const bool& defer_nested) {
+	const auto deferred = std::move(container.m_deferred);
+	container.m_deferred.reset();
+	return Materialize(*deferred, container, defer_nested);
 }
 
-template<> StormByte::Expected<double, StormByte::Config::ParseError> Parser::ParseValue<double>(std::istream& istream) {
-	const std::string buffer = GetStringIgnoringWS(istream);
-
-	// std::stod just ignore extra characters so we better check
-	if (!std::regex_match(buffer, c_double_regex))
-		return Unexpected<ParseError>(m_current_line, "Failed to parse double value '" + buffer + "'");
-	try {
-		double result = std::stod(buffer);
-		return result;
-	}
-	catch (std::invalid_argument&) {
-		return Unexpected<ParseError>(m_current_line, "Failed to parse double value");
-	}
-	catch (std::out_of_range&) {
-		return Unexpected<ParseError>(m_current_line, "Double value " + buffer + " out of range");
+void Parser::FindDeferred(Item::Container& container, std::vector<Item::Container*>& pending) {
+	for (const auto& item: *container.m_items) {
+		if (item->Type() == Item::Type::Container && item->Value<Item::Container>().IsPending())
+			pending.push_back(&item->Value<Item::Container>());
 	}
 }
 
-template<> StormByte::Expected<int, StormByte::Config::ParseError> Parser::ParseValue<int>(std::istream& istream) {
-	const std::string buffer = GetStringIgnoringWS(istream);
-
-	// stoi will ignore extra characters so we force check
-	if (!std::regex_match(buffer, c_int_regex))
-		return Unexpected<ParseError>(m_current_line, "Failed to parse integer value '" + buffer + '"');
-	try {
-		int result = std::stoi(buffer);
-		return result;
-	}
-	catch (std::invalid_argument&) {
-		return Unexpected<ParseError>(m_current_line, "Failed to parse integer value '" + buffer + '"');
-	}
-	catch (std::out_of_range&) {
-		return Unexpected<ParseError>(m_current_line, "Integer value " + buffer + " out of range");
-	}
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::string_view buffer, Handler& handler) {
+	Parser parser(Reader(buffer), handler);
+	return parser.Dispatch();
 }
 
-template<> StormByte::Expected<std::string, StormByte::Config::ParseError> Parser::ParseValue<std::string>(std::istream& istream) {
-	ConsumeWS(istream);
-	std::string accumulator;
-	// Guesser already detected the opened " so we skip it
-	istream.seekg(1, std::ios::cur);
-	bool string_closed = false;
-
-	if (istream.eof())
-		return Unexpected<ParseError>(m_current_line, "String content was expected but found EOF");
-
-	// Do not skip space characters
-	bool escape_next = false;
-	char c;
-	while (istream.get(c)) {
-		if (escape_next) {
-			// Handle escaped characters
-			switch (c) {
-				case '"':
-				case '\\':
-					accumulator += c;
-					break;
-				case 'n':
-					accumulator += '\n';
-					break;
-				case 'r':
-					accumulator += '\r';
-					break;
-				case 't':
-					accumulator += '\t';
-					break;
-				default:
-					return Unexpected<ParseError>(m_current_line, std::string("Invalid escape sequence: \\") + std::string(1, c));
-					break;
-			}
-			escape_next = false;
-		} else {
-			switch(c) {
-				case '\\':
-					// Indicate that the next character should be escaped
-					escape_next = true;
-					break;
-				case '"':
-					string_closed = true;
-					goto end;
-				case '\n':
-					m_current_line++;
-					[[fallthrough]];
-				default:
-					accumulator += c;
-					break;
-			}
-		}
+template<> StormByte::Expected<double, StormByte::Config::ParseError> Parser::ParseValue<double>(const Reader::Token& token) {
+	double result;
+	switch (ToNumber(token.raw, result)) {
+		case ConversionResult::Success:
+			return result;
+		case ConversionResult::OutOfRange:
+			return Unexpected<ParseError>(token.Line(), "Double value " + std::string(token.raw) + " out of range");
+		default:
+			return Unexpected<ParseError>(token.Line(), "Failed to parse double value '" + std::string(token.raw) + "'");
 	}
-
-	end:
-	if (!string_closed)
-		return Unexpected<ParseError>(m_current_line, "Expected string closure but got EOF");
-
-	return accumulator;
 }
 
-template<> StormByte::Expected<bool, StormByte::Config::ParseError> Parser::ParseValue<bool>(std::istream& istream) {
-	const std::string buffer = GetStringIgnoringWS(istream);
-	if (buffer != "true" && buffer != "false")
-		return Unexpected<ParseError>(m_current_line, "Failed to parse boolean value '" + buffer + "'");
-	return buffer == "true";
+template<> StormByte::Expected<int, StormByte::Config::ParseError> Parser::ParseValue<int>(const Reader::Token& token) {
+	int result;
+	switch (ToNumber(token.raw, result)) {
+		case ConversionResult::Success:
+			return result;
+		case ConversionResult::OutOfRange:
+			return Unexpected<ParseError>(token.Line(), "Integer value " + std::string(token.raw) + " out of range");
+		default:
+			return Unexpected<ParseError>(token.Line(), "Failed to parse integer value '" + std::string(token.raw) + "'");
+	}
 }
 
-CommentType Parser::FindComment(std::istream& istream) {
-	ConsumeWS(istream);
-	if (istream.eof())
-		return CommentType::None;
-	char c;
-	auto current_position = istream.tellg();
-	istream.get(c);
-	if (c == '#') {
-		return CommentType::SingleLineBash;
-	}
-	else if (c == '/') {
-		istream.get(c);
-		if (c == '*') {
-			return CommentType::MultiLineC;
-		}
-		else if (c == '/') {
-			return CommentType::SingleLineC;
-		}
-	}
-	else {
-		istream.clear();
-		istream.seekg(current_position);
-	}
-	return CommentType::None;
+template<> StormByte::Expected<bool, StormByte::Config::ParseError> Parser::ParseValue<bool>(const Reader::Token& token) {
+	if (token.raw != "true" && token.raw != "false")
+		return Unexpected<ParseError>(token.Line(), "Failed to parse boolean value '" + std::string(token.raw) + "'");
+	return token.raw == "true";
 }
 
-StormByte::Expected<void, StormByte::Config::ParseError> Parser::FindAndParseComments(std::istream& istream, Item::Container& container) {
-	CommentType type;
-	while ((type = FindComment(istream)) != CommentType::None) {
-		switch (type) {
-			case CommentType::SingleLineBash: {
-				auto res = ParseValue<Item::Comment<Item::CommentType::SingleLineBash>>(istream);
-				if (res)
-					container.Add(std::move(res.value()));
-				else
-					return Unexpected(std::move(res.error()));
+void Parser::Unescape(std::string_view raw, std::string& output) {
+	output.clear();
+	output.reserve(raw.size());
+	// Copy whole spans between escape sequences
+	for (std::size_t position = raw.find('\\'); position != std::string_view::npos; position = raw.find('\\')) {
+		output.append(raw.substr(0, position));
+		switch (raw[position + 1]) {
+			case 'n':
+				output += '\n';
 				break;
-			}
-			case CommentType::SingleLineC: {
-				auto res = ParseValue<Item::Comment<Item::CommentType::SingleLineC>>(istream);
-				if (res)
-					container.Add(std::move(res.value()));
-				else
-					return Unexpected(std::move(res.error()));
+			case 'r':
+				output += '\r';
 				break;
-			}
-			case CommentType::MultiLineC: {
-				auto res = ParseValue<Item::Comment<Item::CommentType::MultiLineC>>(istream);
-				if (res)
-					container.Add(std::move(res.value()));
-				else
-					return Unexpected(std::move(res.error()));
+			case 't':
+				output += '\t';
+				break;
+			default:
+				output += raw[position + 1];
 				break;
-			}
-			case CommentType::None:
-				return {};
 		}
+		raw.remove_prefix(position + 2);
 	}
-	return {};
+	output.append(raw);
 }
 
-StormByte::Expected<StormByte::Config::Item::Base::PointerType, StormByte::Config::ParseError> Parser::ParseItem(std::istream& istream, const Item::Type& type) {
-	switch(type) {
-		case Item::Type::Container: {
-			m_container_level++;
-			auto container_type = ParseContainerType(istream);
-			if (container_type) {
-				switch (container_type.value()) {
-					case Item::ContainerType::Group: {
-						Item::Group group;
-						auto res = Parse(istream, group, Mode::Named);
-						if (!res)
-							return Unexpected(std::move(res.error()));
-						return group.Move();
-					}
-					case Item::ContainerType::List: {
-						Item::List list;
-						auto res = Parse(istream, list, Mode::Unnamed);
-						if (!res)
-							return Unexpected(std::move(res.error()));
-						return list.Move();
-					}
-					default:
-						return Unexpected<ParseError>(m_current_line, "Unknown container type");
-				}
-			}
-			else
-				return Unexpected(std::move(container_type.error()));
-		}
-		case Item::Type::Comment: // Not handled here but make compiler not emit any warning
-			return nullptr;
-		case Item::Type::String: {
-			auto res = ParseValue<std::string>(istream);
-			if (res)
-				return Item::Base::MakePointer<Item::Value<std::string>>(std::move(res.value()));
-			else
-				return Unexpected(std::move(res.error()));
-		}
-		case Item::Type::Integer: {
-			auto res = ParseValue<int>(istream);
-			if (res)
-				return Item::Base::MakePointer<Item::Value<int>>(std::move(res.value()));
-			else
-				return Unexpected(std::move(res.error()));
-		}
-		case Item::Type::Double: {
-			auto res = ParseValue<double>(istream);
-			if (res)
-				return Item::Base::MakePointer<Item::Value<double>>(std::move(res.value()));
-			else
-				return Unexpected(std::move(res.error()));
-		}
-		case Item::Type::Bool: {
-			auto res = ParseValue<bool>(istream);
-			if (res)
-				return Item::Base::MakePointer<Item::Value<bool>>(std::move(res.value()));
-			else
-				return Unexpected(std::move(res.error()));
+StormByte::Expected<std::size_t, StormByte::Config::ParseError> Parser::Resume(std::string_view buffer, const bool& last) {
+	*m_reader.m_lexer = Lexer(buffer, m_reader.m_lexer->Line());
+	while (true) {
+		const Lexer checkpoint = *m_reader.m_lexer;
+		const Reader::State state = m_reader.m_state;
+		const std::size_t depth = m_reader.m_open.size();
+		const Item::ContainerType innermost = depth == 0 ? Item::ContainerType::Group : m_reader.m_open.back();
+
+		auto res = m_reader.Read();
+		// A token (or an error) reaching the end of the buffer could continue in the next chunk so it is read again then
+		if (!last && m_reader.m_lexer->EoF()) {
+			*m_reader.m_lexer = checkpoint;
+			m_reader.m_state = state;
+			if (m_reader.m_open.size() > depth)
+				m_reader.m_open.pop_back();
+			else if (m_reader.m_open.size() < depth)
+				m_reader.m_open.push_back(innermost);
+			// Line breaks are counted while the buffer is still there, so the next chunk starts at the right line
+			(void)m_reader.m_lexer->Line();
+			return checkpoint.Position();
 		}
-		default:
-			return Unexpected<ParseError>(m_current_line, "Unknown item type");
+		if (!res)
+			return Unexpected(std::move(res.error()));
+		if (res.value().type == Reader::TokenType::EoF)
+			return buffer.size();
+
+		auto dispatch_res = Dispatch(res.value());
+		if (!dispatch_res)
+			return Unexpected(std::move(dispatch_res.error()));
 	}
 }
 
-StormByte::Expected<void, StormByte::Config::ParseError> Parser::Parse(std::istream& istream, Item::Container& container, const Mode& mode) {
-	bool halt = false;
-	auto res = FindAndParseComments(istream, container);
-	if (!res)
-		return Unexpected(std::move(res.error()));
-	while (!halt && !istream.eof()) {
-		std::string item_name;
-
-		if (mode == Mode::Named) {
-			// Item Name
-			auto res = ParseItemName(istream);
-			if (res)
-				item_name = std::move(res.value());
-			else
-				return Unexpected(std::move(res.error()));
-			
-			// Equal expected
-			std::string equal = GetStringIgnoringWS(istream);
-			if (equal != "=") {
-				return Unexpected<ParseError>(m_current_line, "Expected '=' after item name " + item_name + " but got " + equal);
-			}
-		}
-
-		// Guessing type
-		auto type_res = ParseType(istream);
-		if (!type_res)
-			return Unexpected(std::move(type_res.error()));
-		Item::Type type = type_res.value();
-
-		auto item_res = ParseItem(istream, type);
-		if (!item_res)
-			return Unexpected(std::move(item_res.error()));
-
-		auto item = std::move(item_res.value());
-
-		if (mode == Mode::Named)
-			item->Name(std::move(item_name));
-
-		container.Add(item, c_on_existing_action);
-
-		res = FindAndParseComments(istream, container);
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Dispatch() {
+	while (true) {
+		auto res = m_reader.Read();
 		if (!res)
 			return Unexpected(std::move(res.error()));
+		if (res.value().type == Reader::TokenType::EoF)
+			return {};
 
-		if (FindContainerEnd(istream, container.ContainerType())) {
-			// If it is encountered on level 0 it is a syntax error
-			if (m_container_level == 0)
-				return Unexpected<ParseError>(m_current_line, "return Unexpected container end symbol");
-			else
-				m_container_level--;
-			
-			halt = true;
-		}
-
-		if (istream.fail()) {
-			if (m_container_level > 0)
-				return Unexpected<ParseError>(m_current_line, "return Unexpected EOF");
-			else
-				halt = true;
-		}
+		auto dispatch_res = Dispatch(res.value());
+		if (!dispatch_res)
+			return Unexpected(std::move(dispatch_res.error()));
 	}
-	return {};
 }
 
-StormByte::Expected<std::string, StormByte::Config::ParseError> Parser::ParseItemName(std::istream& istream) {
-	const std::string name = GetStringIgnoringWS(istream);
-	if (!Item::IsNameValid(name)) {
-		return Unexpected<ParseError>(m_current_line, "Invalid item name: " + name);
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Dispatch(const Reader::Token& token) {
+	if (m_builder)
+		m_builder->Locate(m_reader.m_lexer->Begin() + token.offset);
+	switch (token.type) {
+		case Reader::TokenType::GroupBegin:
+		case Reader::TokenType::ListBegin:
+			if (m_deferring_builder)
+				return Defer(token);
+			if (token.type == Reader::TokenType::GroupBegin)
+				m_handler.OnGroupBegin(token.name);
+			else
+				m_handler.OnListBegin(token.name);
+			return {};
+		case Reader::TokenType::End:
+			m_handler.OnEnd(token.container);
+			return {};
+		case Reader::TokenType::Comment:
+			m_handler.OnComment(token.comment, token.raw);
+			return {};
+		case Reader::TokenType::Value:
+			return DispatchValue(token);
+		case Reader::TokenType::Include:
+			return DispatchInclude(token);
+		default:
+			return {};
 	}
-	return name;
 }
 
-StormByte::Expected<StormByte::Config::Item::Type, StormByte::Config::ParseError> Parser::ParseType(std::istream& istream) {
-	/**** THIS FUNCTION ONLY DETECTS TYPE NOT CHECKS FOR VALIDITY *****/
-	std::unique_ptr<Item::Type> type;
-	ConsumeWS(istream);
-	auto start_position = istream.tellg();
-	std::string line;
-	std::getline(istream, line);
-	/** COMMENTS ARE NOT HANDLED HERE **/
-	switch (line[0]) {
-		case '"':
-			type = std::make_unique<Item::Type>(Item::Type::String);
-			break;
-		case '[':
-		case '{':
-			type = std::make_unique<Item::Type>(Item::Type::Container);
-			break;
-		case '-':
-		case '+':
-		case '0':
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9': {
-			// Possible int or double, we assume int until we find a "." (not exp notation as without a . it is allowed in integers too)
-			// NOTE: We don't do sanity check here!
-			type = std::make_unique<Item::Type>(Item::Type::Integer);
-			bool halt = false;
-			size_t pos = 1;
-			while (pos < line.size() && !halt) {
-				if (line[pos++] == '.') {
-					type = std::make_unique<Item::Type>(Item::Type::Double);
-					halt = true;
-				}
-			}
-			break;
-		}
-		case 't':
-		case 'f':
-			type = std::make_unique<Item::Type>(Item::Type::Bool);
-			break;
-		default: {
-			return Unexpected<ParseError>(m_current_line, "return Unexpected " + std::string(1, line[0]) + " when parsing item type");
-		}
-	}
-	istream.seekg(start_position);
-	return *type;
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::Defer(const Reader::Token& token) {
+	const std::string_view remaining = m_reader.m_lexer->Remaining();
+	const unsigned int line = m_reader.m_lexer->Line();
+	auto res = m_reader.Skip();
+	if (!res)
+		return Unexpected(std::move(res.error()));
+
+	const std::string_view body = remaining.substr(0, remaining.size() - m_reader.m_lexer->Remaining().size());
+	m_deferring_builder->OnDeferred(token.container, token.name, Deferred { m_retained, body, line, OnExistingAction::ThrowException, OnCommentAction::Keep, nullptr, {} });
+	return {};
 }
 
-StormByte::Expected<StormByte::Config::Item::ContainerType, StormByte::Config::ParseError> Parser::ParseContainerType(std::istream& istream) {
-	/**** THIS FUNCTION ONLY DETECTS TYPE NOT CHECKS FOR VALIDITY *****/
-	char c = '\0';
-	ConsumeWS(istream);
-	istream.get(c);
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::DispatchInclude(const Reader::Token& token) {
+	Unescape(token.raw, m_unescaped);
+	// Errors found while including are reported at the directive
 	try {
-		return Item::TypeFromStartCharacter(c);
+		m_handler.OnInclude(m_unescaped);
 	}
-	catch (const StormByte::Exception&) {
-		return Unexpected<ParseError>(m_current_line, "Unknown start character " + std::string(1, c) + " for container");
+	catch (const Exception& e) {
+		return Unexpected<ParseError>(token.Line(), "Can not include " + m_unescaped + ": " + e.what());
 	}
+	return {};
 }
 
-bool Parser::FindContainerEnd(std::istream& istream, const Item::ContainerType& container_type) {
-	/**** THIS FUNCTION ONLY DETECTS TYPE NOT CHECKS FOR VALIDITY *****/
-	ConsumeWS(istream);
-	char c;
-	bool result = false;
-	if (istream.get(c)) {
-		if (Item::Container::EnclosureCharacters(container_type).second == c)
-			result = true;
-		else
-			istream.unget();
-	}
-	return result;
-}
-
-void Parser::ConsumeWS(std::istream& istream) {
-	char c;
-	while (istream.get(c)) {
-		switch(c) {
-			case '\n':
-				m_current_line++;
-				[[fallthrough]];
-			case ' ':
-			case '\t':
-			case '\r':
-				continue;
-			default:
-				istream.unget();
-				return;
+StormByte::Expected<void, StormByte::Config::ParseError> Parser::DispatchValue(const Reader::Token& token) {
+	switch (token.kind) {
+		case Item::Type::String:
+			// Strings without escape sequences are passed as a view of the input buffer
+			if (token.raw.find('\\') == std::string_view::npos)
+				m_handler.OnValue(token.name, token.raw);
+			else {
+				Unescape(token.raw, m_unescaped);
+				m_handler.OnValue(token.name, std::string_view(m_unescaped));
+			}
+			return {};
+		case Item::Type::Integer: {
+			auto res = ParseValue<int>(token);
+			if (!res)
+				return Unexpected(std::move(res.error()));
+			m_handler.OnValue(token.name, res.value());
+			return {};
 		}
-	}
-}
-
-std::string Parser::GetStringIgnoringWS(std::istream& istream) {
-	ConsumeWS(istream);
-	std::string buffer = "";
-	bool character_found = false;
-	char c;
-	while (istream.get(c)) {
-		switch(c) {
-			case '\n':
-				m_current_line++;
-				[[fallthrough]];
-			case ' ':
-			case '\t':
-			case '\r':
-				if (character_found)
-					return buffer;
-				break;
-			default:
-				character_found = true;
-				buffer += c;
-				continue;
+		case Item::Type::Double: {
+			auto res = ParseValue<double>(token);
+			if (!res)
+				return Unexpected(std::move(res.error()));
+			m_handler.OnValue(token.name, res.value());
+			return {};
+		}
+		case Item::Type::Bool: {
+			auto res = ParseValue<bool>(token);
+			if (!res)
+				return Unexpected(std::move(res.error()));
+			m_handler.OnValue(token.name, res.value());
+			return {};
 		}
+		default:
+			return Unexpected<ParseError>(token.Line(), "Unknown item type");
 	}
-	return buffer;
 }
 
 namespace StormByte::Config::Parser {
-	StormByte::Expected<void, StormByte::Config::ParseError> Parse(std::istream& stream, Item::Group& root, const StormByte::Config::OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
-		return Parser::Parse(stream, root, action, before, after, on_failure);
+	StormByte::Expected<void, StormByte::Config::ParseError> Parse(std::istream& stream, Item::Group& root, const StormByte::Config::OnExistingAction& action, const StormByte::Config::OnCommentAction& comments, const Context& context, const StormByte::Config::ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+		return Parser::Parse(stream, root, action, comments, context, mode, before, after, on_failure);
+	}
+
+	StormByte::Expected<void, StormByte::Config::ParseError> Parse(std::string_view buffer, Item::Group& root, const StormByte::Config::OnExistingAction& action, const StormByte::Config::OnCommentAction& comments, const Context& context, const StormByte::Config::ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+		return Parser::Parse(buffer, root, action, comments, context, mode, before, after, on_failure);
 	}
 
-	StormByte::Expected<void, StormByte::Config::ParseError> Parse(const std::string& string, Item::Group& root, const StormByte::Config::OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
-		return Parser::Parse(string, root, action, before, after, on_failure);
+	StormByte::Expected<void, StormByte::Config::ParseError> Parse(Source&& source, Item::Group& root, const StormByte::Config::OnExistingAction& action, const StormByte::Config::OnCommentAction& comments, const Context& context, const StormByte::Config::ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure) {
+		return Parser::Parse(std::move(source), root, action, comments, context, mode, before, after, on_failure);
 	}
 }
\ No newline at end of file
@@ -3,16 +3,21 @@
 #include <StormByte/alias.hxx>
 #include <StormByte/config/alias.hxx>
 #include <StormByte/config/exception.hxx>
-#include <StormByte/config/item/comment.hxx>
+#include <StormByte/config/handler.hxx>
+#include <StormByte/config/incremental_parser.hxx>
 #include <StormByte/config/item/group.hxx>
-#include <StormByte/config/item/list.hxx>
-#include <StormByte/config/item/value.hxx>
-#include <StormByte/config/parser/type.hxx>
+#include <StormByte/config/parser/builder.hxx>
+#include <StormByte/config/parser/context.hxx>
+#include <StormByte/config/parser/deferred.hxx>
+#include <StormByte/config/parser/source.hxx>
+#include <StormByte/config/reader.hxx>
 #include <StormByte/config/type.hxx>
 
 #include <istream>
-#include <regex>
+#include <memory>
 #include <string>
+#include <vector>
+#include <string_view>
 
 /**
  * @namespace Parser
@@ -43,7 +48,7 @@ namespace StormByte::Config::Parser {
 			 * Move assignment operator
 			 * @param p parser to move
 			 */
-			Parser& operator=(Parser&& p) 							= default;
+			Parser& operator=(Parser&& p) 							= delete;
 
 			/**
 			 * Destructor
@@ -55,134 +60,236 @@ namespace StormByte::Config::Parser {
 			 * @param stream input stream
 			 * @param root root group to start
 			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param context what the built items are attached to
+			 * @param mode how nested containers are parsed
 			 * @param before hooks to call before parsing
 			 * @param after hooks to call after parsing
 			 */
-			static Expected<void, ParseError>						Parse(std::istream& stream, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+			static Expected<void, ParseError>						Parse(std::istream& stream, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
 
 			/**
 			 * Parse a configuration file
-			 * @param string input string
+			 * @param buffer input buffer (it is only copied in lazy mode)
 			 * @param root root group to start
 			 * @param action action to take when a name is already in use
-			 * @return Group with parsed information
+			 * @param comments what to do with comments
+			 * @param context what the built items are attached to
+			 * @param mode how nested containers are parsed
+			 * @param before hooks to call before parsing
+			 * @param after hooks to call after parsing
+			 */
+			static Expected<void, ParseError>						Parse(std::string_view buffer, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+
+			/**
+			 * Parse a configuration file
+			 * @param source input source (it is retained by lazily parsed containers)
+			 * @param root root group to start
+			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param context what the built items are attached to
+			 * @param mode how nested containers are parsed
+			 * @param before hooks to call before parsing
+			 * @param after hooks to call after parsing
+			 */
+			static Expected<void, ParseError>						Parse(Source&& source, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+
+			/**
+			 * Parses the deferred contents of a container
+			 * @param deferred deferred contents
+			 * @param container container to fill
+			 * @param defer_nested defer again the nested containers?
+			 */
+			static Expected<void, ParseError>						Materialize(const Deferred& deferred, Item::Container& container, const bool& defer_nested = true);
+
+			/**
+			 * Parse a configuration file emitting events to a handler
+			 * @param buffer input buffer (it is not copied)
+			 * @param handler handler to receive the events
+			 */
+			static Expected<void, ParseError>						Parse(std::string_view buffer, Handler& handler);
+
+			/**
+			 * Runs the hooks once parsing finishes
+			 * @param res parse result
+			 * @param root root group
+			 * @param after hooks to call after a successful parse
+			 * @param on_failure hook to call on failure (the error is dropped if it returns false)
+			 * @return parse result after the hooks
+			 */
+			static Expected<void, ParseError>						Conclude(Expected<void, ParseError>&& res, Item::Group& root, const HookFunctions& after, const OptionalFailureHook& on_failure);
+
+			/**
+			 * Converts a value token
+			 * @param token token to convert
+			 * @return converted value
+			 */
+			template<typename T> static Expected<T, ParseError>		ParseValue(const Reader::Token& token);
+
+			/**
+			 * Resolves the escape sequences of a raw string (which were already validated by the reader)
+			 * @param raw raw string contents
+			 * @param output string to store the result to (it is overwritten)
 			 */
-			static Expected<void, ParseError>						Parse(const std::string& string, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+			static void 											Unescape(std::string_view raw, std::string& output);
 
 		private:
-			unsigned int 											m_container_level;					///< Container level
-			unsigned int 											m_current_line;						///< Current line (for parser)
-			const OnExistingAction 									c_on_existing_action;				///< Action to take when item name already exists
-			static const std::regex 								c_double_regex;						///< Double detection regex
-			static const std::regex 								c_int_regex;						///< Integer detection regex
+			friend class StormByte::Config::IncrementalParser;
+
+			Reader 													m_reader;							///< Cursor over the input buffer
+			Handler& 												m_handler;							///< Handler receiving the events
+			Builder* 												m_builder;							///< Handler when it is a builder (told where items start)
+			Builder* 												m_deferring_builder;				///< Builder receiving unparsed containers (lazy mode only)
+			std::shared_ptr<const Source> 							m_retained;							///< Source retained by unparsed containers (lazy mode only)
+			std::string 											m_unescaped;						///< Reused buffer for strings with escape sequences
 
 			/**
 			 * Constructor
-			 * @param action action to take when a name is already in use
+			 * @param reader reader over the input
+			 * @param handler handler to receive the events
 			 */
-			Parser(const OnExistingAction& action);
+			Parser(Reader&& reader, Handler& handler);
 
 			/**
-			 * Starts parsing
-			 * @param istream input stream
+			 * Constructor for a builder
+			 * @param reader reader over the input
+			 * @param builder builder to receive the items
 			 */
-			void 													StartParse(std::istream& istream);
+			Parser(Reader&& reader, Builder& builder);
 
 			/**
-			 * Parses a value
-			 * @param istream input stream
-			 * @return parsed value
+			 * Constructor for lazy mode
+			 * @param reader reader over the retained source
+			 * @param builder builder to receive the items and unparsed containers
+			 * @param retained retained source
 			 */
-			template<typename T> Expected<T, ParseError>			ParseValue(std::istream& istream);
+			Parser(Reader&& reader, Builder& builder, std::shared_ptr<const Source> retained);
 
 			/**
-			 * Finds a comment and returns its type
-			 * @param istream input stream
-			 * @return comment type
+			 * Builds an item tree running the hooks
+			 * @param buffer input buffer
+			 * @param retained source retained by unparsed containers (only for lazy mode)
+			 * @param directory directory relative includes are resolved from (null for working directory)
+			 * @param root root group to start
+			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param context what the built items are attached to
+			 * @param before hooks to call before parsing
+			 * @param after hooks to call after parsing
 			 */
-			CommentType												FindComment(std::istream& istream);
+			static Expected<void, ParseError>						Build(std::string_view buffer, std::shared_ptr<const Source> retained, std::shared_ptr<const std::filesystem::path> directory, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
 
 			/**
-			 * Finds and parses comments
-			 * @param istream input stream
-			 * @param container container to put comments to
+			 * Parses splitting the input by containers which are parsed on the thread pool
+			 *
+			 * Containers are found first by bracket matching only (deferring them), splitting
+			 * the biggest ones until there is work for every thread, and then parsed concurrently.
+			 * @param buffer input buffer
+			 * @param directory directory relative includes are resolved from (null for working directory)
+			 * @param root root group to add items to
+			 * @param action action to take when a name is already in use
+			 * @param comments what to do with comments
+			 * @param context what the built items are attached to
+			 * @return bool parsed? (nothing is added on failure so it can be parsed sequentially to get the error)
 			 */
-			Expected<void, ParseError>								FindAndParseComments(std::istream& istream, Item::Container& container);
+			static bool 											BuildParallel(std::string_view buffer, const std::shared_ptr<const std::filesystem::path>& directory, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context);
 
 			/**
-			 * Parses an item
-			 * @param istream input stream
-			 * @param type item type
-			 * @return parsed item
+			 * Parses the deferred contents of a container
+			 * @param container container to parse
+			 * @param defer_nested defer again the nested containers?
 			 */
-			Expected<Item::Base::PointerType, ParseError>			ParseItem(std::istream& istream, const Item::Type& type);
+			static Expected<void, ParseError>						Materialize(Item::Container& container, const bool& defer_nested);
 
 			/**
-			 * Parses a group
-			 * @param istream input stream
-			 * @param container Container to put data to
+			 * Appends the containers whose contents are deferred
+			 * @param container container to look into
+			 * @param pending vector to append the deferred containers to
 			 */
-			Expected<void, ParseError>								Parse(std::istream& istream, Item::Container& container, const Mode& mode);
+			static void 											FindDeferred(Item::Container& container, std::vector<Item::Container*>& pending);
 
 			/**
-			 * Parses an item name
-			 * @param istream input stream
-			 * @return item name
+			 * Skips the container which has just started handing its contents to the builder unparsed
+			 * @param token container begin token
 			 */
-			Expected<std::string, ParseError>						ParseItemName(std::istream& istream);
+			Expected<void, ParseError>								Defer(const Reader::Token& token);
 
 			/**
-			 * Parses an item type
-			 * @param istream input stream
-			 * @return item type
+			 * Reads every token dispatching it to the handler
 			 */
-			Expected<Item::Type, ParseError>						ParseType(std::istream& istream);
+			Expected<void, ParseError>								Dispatch();
 
 			/**
-			 * Parses a container type
-			 * @param istream input stream
-			 * @return container type
+			 * Dispatches a token to the handler (or defers it in lazy mode)
+			 * @param token token to dispatch
 			 */
-			Expected<Item::ContainerType, ParseError>				ParseContainerType(std::istream& istream);
+			Expected<void, ParseError>								Dispatch(const Reader::Token& token);
 
 			/**
-			 * Finds the container end symbol
-			 * @param istream input stream
-			 * @param container_type container type to know the end symbol
-			 * @return bool
+			 * Continues parsing over the unconsumed part of the input dispatching every complete token
+			 *
+			 * Open containers and line number are kept from the previous call, the given buffer has
+			 * to start where the previous one was consumed up to.
+			 * @param buffer unconsumed input
+			 * @param last is it the end of the input? (otherwise tokens reaching the buffer end are not consumed)
+			 * @return number of bytes consumed
 			 */
-			bool 													FindContainerEnd(std::istream& istream, const Item::ContainerType& container_type);
+			Expected<std::size_t, ParseError>						Resume(std::string_view buffer, const bool& last);
 
 			/**
-			 * Consumes whitespace (and tabs, newline, etc) updating line number
-			 * @param istream stream to consume whitespace from
+			 * Dispatches an include token to the handler
+			 * @param token include token
 			 */
-			void 													ConsumeWS(std::istream& istream);
+			Expected<void, ParseError>								DispatchInclude(const Reader::Token& token);
 
 			/**
-			 * Gets a string ignoring leading whitespace updating line number
-			 * @param istream input stream
-			 * @return string value
+			 * Dispatches a value token to the handler
+			 * @param token value token
 			 */
-			std::string 											GetStringIgnoringWS(std::istream& istream);
+			Expected<void, ParseError>								DispatchValue(const Reader::Token& token);
 	};
+
+	// Value conversions available
+	template<> Expected<int, ParseError>							Parser::ParseValue<int>(const Reader::Token& token);
+	template<> Expected<double, ParseError>							Parser::ParseValue<double>(const Reader::Token& token);
+	template<> Expected<bool, ParseError>							Parser::ParseValue<bool>(const Reader::Token& token);
+
 	/**
 	 * Shortcut for Parser static Parse method
 	 * @param stream input stream
 	 * @param root root group to start
 	 * @param action action to take when a name is already in use
+	 * @param comments what to do with comments
+	 * @param context what the built items are attached to
+	 * @param mode how nested containers are parsed
+	 * @throws ParserError If parse errors are found
+	 * @return Group with parsed information
+	 */
+	Expected<void, ParseError> STORMBYTE_CONFIG_PRIVATE 			Parse(std::istream& stream, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+
+	/**
+	 * Shortcut for Parser static Parse method
+	 * @param buffer input buffer
+	 * @param root root group to start
+	 * @param action action to take when a name is already in use
+	 * @param comments what to do with comments
+	 * @param context what the built items are attached to
+	 * @param mode how nested containers are parsed
 	 * @throws ParserError If parse errors are found
 	 * @return Group with parsed information
 	 */
-	Expected<void, ParseError> STORMBYTE_CONFIG_PRIVATE 			Parse(std::istream& stream, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+	Expected<void, ParseError> STORMBYTE_CONFIG_PRIVATE 			Parse(std::string_view buffer, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
 
 	/**
 	 * Shortcut for Parser static Parse method
-	 * @param string input string
+	 * @param source input source
 	 * @param root root group to start
 	 * @param action action to take when a name is already in use
+	 * @param comments what to do with comments
+	 * @param context what the built items are attached to
+	 * @param mode how nested containers are parsed
 	 * @throws ParserError If parse errors are found
 	 * @return Group with parsed information
 	 */
-	Expected<void, ParseError> STORMBYTE_CONFIG_PRIVATE 			Parse(const std::string& string, Item::Group& root, const OnExistingAction& action, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
+	Expected<void, ParseError> STORMBYTE_CONFIG_PRIVATE 			Parse(Source&& source, Item::Group& root, const OnExistingAction& action, const OnCommentAction& comments, const Context& context, const ParseMode& mode, const HookFunctions& before, const HookFunctions& after, const OptionalFailureHook& on_failure);
 }
\ No newline at end of file
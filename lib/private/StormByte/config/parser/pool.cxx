@@ -0,0 +1,80 @@
+#include <StormByte/config/parser/pool.hxx>
+
+using namespace StormByte::Config::Parser;
+
+ThreadPool::ThreadPool(const std::size_t& threads):m_stopping(false) {
+	m_workers.reserve(threads);
+	for (std::size_t i = 0; i < threads; i++)
+		m_workers.emplace_back(&ThreadPool::Work, this);
+}
+
+ThreadPool::~ThreadPool() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_work_available.notify_all();
+	for (auto& worker: m_workers)
+		worker.join();
+}
+
+ThreadPool& ThreadPool::Default() {
+	// Caller thread also runs tasks so one hardware thread is left for it
+	static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+	return pool;
+}
+
+void ThreadPool::ForEach(const std::size_t& count, const std::function<void(std::size_t)>& task) {
+	if (count == 0)
+		return;
+
+	auto batch = std::make_shared<Batch>();
+	batch->task = &task;
+	batch->count = count;
+	batch->next = 0;
+	batch->finished = 0;
+	if (count > 1 && !m_workers.empty()) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_batches.push_back(batch);
+		}
+		m_work_available.notify_all();
+	}
+
+	Run(*batch);
+
+	// Tasks taken by workers may still be running
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_batch_finished.wait(lock, [&batch]() { return batch->finished == batch->count; });
+}
+
+void ThreadPool::Run(Batch& batch) {
+	std::size_t index;
+	while ((index = batch.next++) < batch.count) {
+		(*batch.task)(index);
+		if (++batch.finished == batch.count) {
+			// Lock so the notification can not be lost between the waiter check and its wait
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_batch_finished.notify_all();
+		}
+	}
+}
+
+void ThreadPool::Work() {
+	while (true) {
+		std::shared_ptr<Batch> batch;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_work_available.wait(lock, [this]() { return m_stopping || !m_batches.empty(); });
+			if (m_stopping)
+				return;
+			batch = m_batches.front();
+			// Batch is left queued while it has tasks to start so other workers join
+			if (batch->next >= batch->count) {
+				m_batches.pop_front();
+				continue;
+			}
+		}
+		Run(*batch);
+	}
+}
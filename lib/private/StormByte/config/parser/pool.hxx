@@ -0,0 +1,112 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class ThreadPool
+	 * @brief Fixed set of worker threads running batches of indexed tasks
+	 *
+	 * The thread submitting a batch also runs its tasks while waiting, so batches
+	 * can be submitted from inside other batches without exhausting the workers.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE ThreadPool {
+		public:
+			/**
+			 * Constructor
+			 * @param threads number of worker threads
+			 */
+			ThreadPool(const std::size_t& threads);
+
+			/**
+			 * Copy constructor
+			 */
+			ThreadPool(const ThreadPool&) 							= delete;
+
+			/**
+			 * Move constructor
+			 */
+			ThreadPool(ThreadPool&&) 								= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			ThreadPool& operator=(const ThreadPool&) 				= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			ThreadPool& operator=(ThreadPool&&) 					= delete;
+
+			/**
+			 * Destructor (waits for the workers to finish)
+			 */
+			~ThreadPool() noexcept;
+
+			/**
+			 * Gets the process wide pool (one worker per hardware thread)
+			 * @return thread pool
+			 */
+			static ThreadPool& 										Default();
+
+			/**
+			 * Gets the number of threads which can run tasks at once (workers plus caller)
+			 * @return concurrency
+			 */
+			inline std::size_t 										Concurrency() const noexcept {
+				return m_workers.size() + 1;
+			}
+
+			/**
+			 * Runs a task for every index in [0, count) returning when all of them finished
+			 * @param count number of tasks
+			 * @param task task to run (it must not throw)
+			 */
+			void 													ForEach(const std::size_t& count, const std::function<void(std::size_t)>& task);
+
+		private:
+			/**
+			 * @struct Batch
+			 * @brief Tasks submitted together
+			 */
+			struct Batch {
+				const std::function<void(std::size_t)>* task;		///< Task to run
+				std::size_t count;									///< Number of tasks
+				std::atomic<std::size_t> next;						///< Next index to run
+				std::atomic<std::size_t> finished;					///< Number of tasks finished
+			};
+
+			std::vector<std::thread> m_workers;						///< Worker threads
+			std::deque<std::shared_ptr<Batch>> m_batches;			///< Batches with tasks not yet started
+			std::mutex m_mutex;										///< Mutex for batches and finished notifications
+			std::condition_variable m_work_available;				///< Notified when a batch is submitted or on stop
+			std::condition_variable m_batch_finished;				///< Notified when a batch finishes
+			bool m_stopping;										///< Workers have to exit
+
+			/**
+			 * Runs tasks from a batch until none is left to start
+			 * @param batch batch to run
+			 */
+			void 													Run(Batch& batch);
+
+			/**
+			 * Worker thread loop
+			 */
+			void 													Work();
+	};
+}
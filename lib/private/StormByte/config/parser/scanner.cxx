@@ -0,0 +1,198 @@
+#include <StormByte/config/parser/scanner.hxx>
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define STORMBYTE_CONFIG_SCANNER_X86
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define STORMBYTE_CONFIG_TARGET(features) __attribute__((target(features)))
+#else
+	#define STORMBYTE_CONFIG_TARGET(features)
+#endif
+
+using namespace StormByte::Config::Parser;
+
+namespace {
+	const char* FindScalar(const char* begin, const char* end, const char& first, const char& second) noexcept {
+		for (; begin != end; begin++) {
+			if (*begin == first || *begin == second)
+				return begin;
+		}
+		return end;
+	}
+
+	constexpr bool IsStructural(const char& character) noexcept {
+		switch (character) {
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case '"':
+			case '\\':
+			case '#':
+			case '/':
+			case '*':
+			case '\n':
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	std::uint64_t StructuralMaskScalar(const char* block, const char* end) noexcept {
+		const std::size_t size = std::min<std::size_t>(static_cast<std::size_t>(end - block), 64);
+		std::uint64_t mask = 0;
+		for (std::size_t i = 0; i < size; i++)
+			mask |= static_cast<std::uint64_t>(IsStructural(block[i])) << i;
+		return mask;
+	}
+
+	std::size_t CountScalar(const char* begin, const char* end, const char& character) noexcept {
+		std::size_t count = 0;
+		for (; begin != end; begin++)
+			count += *begin == character;
+		return count;
+	}
+
+	#ifdef STORMBYTE_CONFIG_SCANNER_X86
+	STORMBYTE_CONFIG_TARGET("sse2")
+	const char* FindSSE2(const char* begin, const char* end, const char& first, const char& second) noexcept {
+		const __m128i first_vector = _mm_set1_epi8(first);
+		const __m128i second_vector = _mm_set1_epi8(second);
+		for (; end - begin >= 16; begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+			const __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, first_vector), _mm_cmpeq_epi8(chunk, second_vector));
+			const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+			if (mask)
+				return begin + std::countr_zero(mask);
+		}
+		return FindScalar(begin, end, first, second);
+	}
+
+	STORMBYTE_CONFIG_TARGET("sse2")
+	std::uint64_t StructuralMaskSSE2(const char* block, const char* end) noexcept {
+		if (end - block < 64)
+			return StructuralMaskScalar(block, end);
+
+		const char characters[] = { '{', '}', '[', ']', '"', '\\', '#', '/', '*', '\n' };
+		std::uint64_t mask = 0;
+		for (int offset = 0; offset < 64; offset += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+			__m128i matches = _mm_setzero_si128();
+			for (const char& character: characters)
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(character)));
+			mask |= static_cast<std::uint64_t>(static_cast<unsigned int>(_mm_movemask_epi8(matches))) << offset;
+		}
+		return mask;
+	}
+
+	STORMBYTE_CONFIG_TARGET("sse2")
+	std::size_t CountSSE2(const char* begin, const char* end, const char& character) noexcept {
+		const __m128i character_vector = _mm_set1_epi8(character);
+		std::size_t count = 0;
+		for (; end - begin >= 16; begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+			count += std::popcount(static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, character_vector))));
+		}
+		return count + CountScalar(begin, end, character);
+	}
+
+	STORMBYTE_CONFIG_TARGET("avx2")
+	const char* FindAVX2(const char* begin, const char* end, const char& first, const char& second) noexcept {
+		const __m256i first_vector = _mm256_set1_epi8(first);
+		const __m256i second_vector = _mm256_set1_epi8(second);
+		for (; end - begin >= 32; begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+			const __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, first_vector), _mm256_cmpeq_epi8(chunk, second_vector));
+			const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(matches));
+			if (mask)
+				return begin + std::countr_zero(mask);
+		}
+		return FindSSE2(begin, end, first, second);
+	}
+
+	STORMBYTE_CONFIG_TARGET("avx2")
+	std::uint64_t StructuralMaskAVX2(const char* block, const char* end) noexcept {
+		if (end - block < 64)
+			return StructuralMaskScalar(block, end);
+
+		const char characters[] = { '{', '}', '[', ']', '"', '\\', '#', '/', '*', '\n' };
+		std::uint64_t mask = 0;
+		for (int offset = 0; offset < 64; offset += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + offset));
+			__m256i matches = _mm256_setzero_si256();
+			for (const char& character: characters)
+				matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(character)));
+			mask |= static_cast<std::uint64_t>(static_cast<unsigned int>(_mm256_movemask_epi8(matches))) << offset;
+		}
+		return mask;
+	}
+
+	STORMBYTE_CONFIG_TARGET("avx2")
+	std::size_t CountAVX2(const char* begin, const char* end, const char& character) noexcept {
+		const __m256i character_vector = _mm256_set1_epi8(character);
+		std::size_t count = 0;
+		for (; end - begin >= 32; begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+			count += std::popcount(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, character_vector))));
+		}
+		return count + CountSSE2(begin, end, character);
+	}
+
+	/**
+	 * Detects the best implementation supported by the running CPU
+	 * @return implementation
+	 */
+	Scanner::Implementation DetectImplementation() noexcept {
+		#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		const int max_leaf = info[0];
+		__cpuid(info, 1);
+		const bool sse2 = (info[3] & (1 << 26)) != 0;
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		bool avx2 = false;
+		// AVX2 needs the OS to save YMM registers
+		if (max_leaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+		#else
+		__builtin_cpu_init();
+		const bool sse2 = __builtin_cpu_supports("sse2");
+		const bool avx2 = __builtin_cpu_supports("avx2");
+		#endif
+		if (avx2)
+			return Scanner::Implementation::AVX2;
+		else if (sse2)
+			return Scanner::Implementation::SSE2;
+		else
+			return Scanner::Implementation::Scalar;
+	}
+	#endif
+}
+
+const Scanner::KernelSet& Scanner::Kernels() noexcept {
+	static const KernelSet kernels = []() -> KernelSet {
+		#ifdef STORMBYTE_CONFIG_SCANNER_X86
+		switch (DetectImplementation()) {
+			case Implementation::AVX2:
+				return { Implementation::AVX2, &FindAVX2, &StructuralMaskAVX2, &CountAVX2 };
+			case Implementation::SSE2:
+				return { Implementation::SSE2, &FindSSE2, &StructuralMaskSSE2, &CountSSE2 };
+			default:
+				break;
+		}
+		#endif
+		return { Implementation::Scalar, &FindScalar, &StructuralMaskScalar, &CountScalar };
+	}();
+	return kernels;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class Scanner
+	 * @brief Byte scanning kernels used by the lexer for long spans
+	 *
+	 * The best implementation available (AVX2, SSE2 or portable scalar) is selected
+	 * once at runtime depending on the CPU features.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Scanner {
+		public:
+			/**
+			 * @enum Implementation
+			 * @brief Kernel implementation
+			 */
+			enum class Implementation: unsigned short {
+				Scalar,		///< Portable implementation
+				SSE2,		///< 16 bytes at a time
+				AVX2		///< 32 bytes at a time
+			};
+
+			/**
+			 * Finds the first occurrence of any of two characters
+			 * @param begin range start
+			 * @param end range end
+			 * @param first first character to find
+			 * @param second second character to find (can be equal to first)
+			 * @return pointer to found character or end if not found
+			 */
+			static inline const char* 								Find(const char* begin, const char* end, const char& first, const char& second) noexcept {
+				return Kernels().find(begin, end, first, second);
+			}
+
+			/**
+			 * Classifies a block of up to 64 bytes marking the characters used to match containers
+			 * (brackets, quotes, backslashes, comment characters and line breaks)
+			 * @param block block start
+			 * @param end buffer end (bytes past it are not read)
+			 * @return mask with bit i set when block[i] is structural
+			 */
+			static inline std::uint64_t 							StructuralMask(const char* block, const char* end) noexcept {
+				return Kernels().structural_mask(block, end);
+			}
+
+			/**
+			 * Counts the occurrences of a character
+			 * @param begin range start
+			 * @param end range end
+			 * @param character character to count
+			 * @return number of occurrences
+			 */
+			static inline std::size_t 								Count(const char* begin, const char* end, const char& character) noexcept {
+				return Kernels().count(begin, end, character);
+			}
+
+			/**
+			 * Gets the implementation in use
+			 * @return implementation
+			 */
+			static inline Implementation 							Selected() noexcept {
+				return Kernels().implementation;
+			}
+
+		private:
+			/**
+			 * @struct KernelSet
+			 * @brief Set of kernels for an implementation
+			 */
+			struct KernelSet {
+				Implementation implementation;																		///< Implementation
+				const char* (*find)(const char*, const char*, const char&, const char&) noexcept;					///< Find kernel
+				std::uint64_t (*structural_mask)(const char*, const char*) noexcept;								///< Structural classification kernel
+				std::size_t (*count)(const char*, const char*, const char&) noexcept;								///< Count kernel
+			};
+
+			/**
+			 * Gets the kernels for the running CPU (detected only once)
+			 * @return kernel set
+			 */
+			static const KernelSet& 								Kernels() noexcept;
+	};
+}
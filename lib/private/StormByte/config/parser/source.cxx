@@ -0,0 +1,122 @@
+#include <StormByte/config/exception.hxx>
+#include <StormByte/config/parser/source.hxx>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#ifdef WINDOWS
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace StormByte::Config::Parser;
+
+Source::Source(std::string&& contents) noexcept:
+m_mapping(nullptr), m_mapping_size(0), m_buffer(std::move(contents)) {}
+
+Source::Source(const char* mapping, const std::size_t& size) noexcept:
+m_mapping(mapping), m_mapping_size(size) {}
+
+Source Source::FromFile(const std::filesystem::path& path) {
+	Source source = Open(path);
+	// Absolute so later working directory changes do not affect includes of lazily parsed containers
+	std::error_code error;
+	const std::filesystem::path absolute = std::filesystem::absolute(path, error);
+	source.m_path = error ? path : absolute;
+	source.m_directory = std::make_shared<const std::filesystem::path>(source.m_path.parent_path());
+	return source;
+}
+
+Source::Source(Source&& source) noexcept:
+m_mapping(std::exchange(source.m_mapping, nullptr)), m_mapping_size(std::exchange(source.m_mapping_size, 0)), m_buffer(std::move(source.m_buffer)), m_directory(std::move(source.m_directory)), m_path(std::move(source.m_path)) {}
+
+Source& Source::operator=(Source&& source) noexcept {
+	if (this != &source) {
+		Unmap();
+		m_mapping = std::exchange(source.m_mapping, nullptr);
+		m_mapping_size = std::exchange(source.m_mapping_size, 0);
+		m_buffer = std::move(source.m_buffer);
+		m_directory = std::move(source.m_directory);
+		m_path = std::move(source.m_path);
+	}
+	return *this;
+}
+
+Source::~Source() noexcept {
+	Unmap();
+}
+
+#ifdef WINDOWS
+Source Source::Open(const std::filesystem::path& path) {
+	// Mapping is only implemented for POSIX systems so a buffered read is done here
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file)
+		throw FileIOError(path.string(), "can not be opened");
+	return Source(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+}
+
+void Source::Unmap() noexcept {}
+#else
+Source Source::Open(const std::filesystem::path& path) {
+	const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		throw FileIOError(path.string(), std::strerror(errno));
+
+	struct stat status;
+	if (::fstat(fd, &status) < 0) {
+		const int error = errno;
+		::close(fd);
+		throw FileIOError(path.string(), std::strerror(error));
+	}
+
+	// Only regular, non empty, files can be mapped
+	if (S_ISREG(status.st_mode) && status.st_size > 0) {
+		const std::size_t size = static_cast<std::size_t>(status.st_size);
+		int flags = MAP_PRIVATE;
+		#ifdef MAP_POPULATE
+		flags |= MAP_POPULATE;
+		#endif
+		void* mapping = ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+		if (mapping != MAP_FAILED) {
+			::close(fd);
+			::madvise(mapping, size, MADV_SEQUENTIAL);
+			return Source(static_cast<const char*>(mapping), size);
+		}
+		// If mapping fails for any reason we still can read it
+	}
+
+	// Pipes, character devices and such: buffered read until EOF
+	std::string contents;
+	if (S_ISREG(status.st_mode) && status.st_size > 0)
+		contents.reserve(static_cast<std::size_t>(status.st_size));
+	char chunk[65536];
+	while (true) {
+		const ssize_t bytes = ::read(fd, chunk, sizeof(chunk));
+		if (bytes > 0)
+			contents.append(chunk, static_cast<std::size_t>(bytes));
+		else if (bytes == 0)
+			break;
+		else if (errno != EINTR) {
+			const int error = errno;
+			::close(fd);
+			throw FileIOError(path.string(), std::strerror(error));
+		}
+	}
+	::close(fd);
+	return Source(std::move(contents));
+}
+
+void Source::Unmap() noexcept {
+	if (m_mapping) {
+		::munmap(const_cast<char*>(m_mapping), m_mapping_size);
+		m_mapping = nullptr;
+		m_mapping_size = 0;
+	}
+}
+#endif
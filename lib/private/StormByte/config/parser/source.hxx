@@ -0,0 +1,125 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	/**
+	 * @class Source
+	 * @brief Contiguous, read only, text to be parsed
+	 *
+	 * Regular files are memory mapped so they can be parsed without any copy while other
+	 * files (pipes, character devices...) and plain strings are kept in an owned buffer.
+	 */
+	class STORMBYTE_CONFIG_PRIVATE Source {
+		public:
+			/**
+			 * Constructor
+			 * @param contents contents to own
+			 */
+			Source(std::string&& contents) noexcept;
+
+			/**
+			 * Copy constructor
+			 */
+			Source(const Source&) 									= delete;
+
+			/**
+			 * Move constructor
+			 * @param source source to move
+			 */
+			Source(Source&& source) noexcept;
+
+			/**
+			 * Assignment operator
+			 */
+			Source& operator=(const Source&) 						= delete;
+
+			/**
+			 * Move assignment operator
+			 * @param source source to move
+			 */
+			Source& operator=(Source&& source) noexcept;
+
+			/**
+			 * Destructor
+			 */
+			~Source() noexcept;
+
+			/**
+			 * Opens a file, mapping it into memory when possible
+			 * @param path file path
+			 * @throw FileIOError if file can not be read
+			 * @return source with file contents
+			 */
+			static Source 											FromFile(const std::filesystem::path& path);
+
+			/**
+			 * Gets the source contents
+			 * @return view of the contents
+			 */
+			constexpr std::string_view 								View() const noexcept {
+				return m_mapping ? std::string_view(m_mapping, m_mapping_size) : std::string_view(m_buffer);
+			}
+
+			/**
+			 * Checks if contents are memory mapped
+			 * @return bool mapped?
+			 */
+			constexpr bool 											IsMapped() const noexcept {
+				return m_mapping != nullptr;
+			}
+
+			/**
+			 * Gets the directory relative includes are resolved from
+			 * @return absolute directory of the file or null when not read from a file
+			 */
+			inline const std::shared_ptr<const std::filesystem::path>& Directory() const noexcept {
+				return m_directory;
+			}
+
+			/**
+			 * Gets the file path
+			 * @return path of the file or empty when not read from a file
+			 */
+			inline const std::filesystem::path& 					Path() const noexcept {
+				return m_path;
+			}
+
+		private:
+			const char* m_mapping;									///< Mapped file (if any)
+			std::size_t m_mapping_size;								///< Mapped file size
+			std::string m_buffer;									///< Owned contents when not mapped
+			std::shared_ptr<const std::filesystem::path> m_directory;	///< Directory of the file (if read from one)
+			std::filesystem::path m_path;							///< File path (if read from one)
+
+			/**
+			 * Constructor for a mapped file
+			 * @param mapping mapped address
+			 * @param size mapping size
+			 */
+			Source(const char* mapping, const std::size_t& size) noexcept;
+
+			/**
+			 * Opens a file, mapping it into memory when possible
+			 * @param path file path
+			 * @throw FileIOError if file can not be read
+			 * @return source with file contents
+			 */
+			static Source 											Open(const std::filesystem::path& path);
+
+			/**
+			 * Releases the mapping (if any)
+			 */
+			void 													Unmap() noexcept;
+	};
+}
@@ -5,15 +5,6 @@
  * @brief Parser namespace
  */
 namespace StormByte::Config::Parser {
-	/**
-	 * @enum Mode
-	 * @brief Parsing mode
-	 */
-	enum class Mode: unsigned short {
-		Named, 		///< Named items
-		Unnamed 	///< Unnamed items
-	};
-
 	/**
 	 * @enum CommentType
 	 * @brief Comment type
@@ -24,4 +15,14 @@ namespace StormByte::Config::Parser {
 		SingleLineC, 	///< SingleLine C/C++ comment
 		MultiLineC 		///< MultiLine C/C++ comment
 	};
+
+	/**
+	 * @enum ConversionResult
+	 * @brief Result of a text to value conversion
+	 */
+	enum class ConversionResult: unsigned short {
+		Success,		///< Value converted
+		Invalid,		///< Text is not a valid representation
+		OutOfRange		///< Value does not fit in the target type
+	};
 };
\ No newline at end of file
@@ -1,36 +1,281 @@
 #include <StormByte/config/config.hxx>
+#include <StormByte/config/parser/arena.hxx>
+#include <StormByte/config/parser/context.hxx>
+#include <StormByte/config/parser/fragment.hxx>
 #include <StormByte/config/parser/parser.hxx>
+#include <StormByte/config/parser/pool.hxx>
+#include <StormByte/config/parser/source.hxx>
+
+#include <algorithm>
+#include <memory>
+#include <spanstream>
+#include <utility>
 
 using namespace StormByte::Config;
 
-Config::Config():m_on_existing_action(OnExistingAction::ThrowException) {}
+Config::Config():m_on_existing_action(OnExistingAction::ThrowException), m_on_comment_action(OnCommentAction::Keep), m_parse_mode(ParseMode::Eager), m_list_mode(ListMode::Unique), m_allocation_mode(AllocationMode::Heap), m_string_mode(StringMode::Copy), m_reference_mode(ReferenceMode::Literal), m_location_mode(LocationMode::Discard), m_pack_mode(PackMode::Items) {}
+
+Config::Config(const Config& config):
+m_root(config.m_root), m_before_read_hooks(config.m_before_read_hooks), m_after_read_hooks(config.m_after_read_hooks),
+m_on_parse_failure_hook(config.m_on_parse_failure_hook), m_on_existing_action(config.m_on_existing_action),
+m_on_comment_action(config.m_on_comment_action), m_parse_mode(config.m_parse_mode), m_list_mode(config.m_list_mode), m_allocation_mode(config.m_allocation_mode), m_string_mode(config.m_string_mode), m_reference_mode(config.m_reference_mode), m_location_mode(config.m_location_mode), m_pack_mode(config.m_pack_mode),
+m_locations(config.m_locations), m_arena(config.m_arena) {
+	Retain(config);
+}
+
+Config::Config(Config&& config) noexcept:
+m_root(std::move(config.m_root)), m_before_read_hooks(std::move(config.m_before_read_hooks)), m_after_read_hooks(std::move(config.m_after_read_hooks)),
+m_on_parse_failure_hook(std::move(config.m_on_parse_failure_hook)), m_on_existing_action(config.m_on_existing_action),
+m_on_comment_action(config.m_on_comment_action), m_parse_mode(config.m_parse_mode), m_list_mode(config.m_list_mode), m_allocation_mode(config.m_allocation_mode), m_string_mode(config.m_string_mode), m_reference_mode(config.m_reference_mode), m_location_mode(config.m_location_mode), m_pack_mode(config.m_pack_mode),
+m_resolver(std::move(config.m_resolver)), m_locations(std::move(config.m_locations)), m_arena(std::move(config.m_arena)) {
+	// Moved items keep resolving their references from the same root, which is now this one
+	if (m_resolver)
+		m_resolver->Root(&m_root);
+}
+
+Config& Config::operator=(const Config& config) {
+	if (this != &config) {
+		m_root					= config.m_root;
+		m_before_read_hooks		= config.m_before_read_hooks;
+		m_after_read_hooks		= config.m_after_read_hooks;
+		m_on_parse_failure_hook	= config.m_on_parse_failure_hook;
+		m_on_existing_action	= config.m_on_existing_action;
+		m_on_comment_action		= config.m_on_comment_action;
+		m_parse_mode			= config.m_parse_mode;
+		m_list_mode				= config.m_list_mode;
+		m_allocation_mode		= config.m_allocation_mode;
+		m_string_mode			= config.m_string_mode;
+		m_reference_mode		= config.m_reference_mode;
+		m_location_mode			= config.m_location_mode;
+		m_pack_mode				= config.m_pack_mode;
+		m_locations				= config.m_locations;
+		m_arena					= config.m_arena;
+		Retain(config);
+	}
+	return *this;
+}
+
+Config& Config::operator=(Config&& config) noexcept {
+	if (this != &config) {
+		m_root					= std::move(config.m_root);
+		m_before_read_hooks		= std::move(config.m_before_read_hooks);
+		m_after_read_hooks		= std::move(config.m_after_read_hooks);
+		m_on_parse_failure_hook	= std::move(config.m_on_parse_failure_hook);
+		m_on_existing_action	= config.m_on_existing_action;
+		m_on_comment_action		= config.m_on_comment_action;
+		m_parse_mode			= config.m_parse_mode;
+		m_list_mode				= config.m_list_mode;
+		m_allocation_mode		= config.m_allocation_mode;
+		m_string_mode			= config.m_string_mode;
+		m_reference_mode		= config.m_reference_mode;
+		m_location_mode			= config.m_location_mode;
+		m_pack_mode				= config.m_pack_mode;
+		if (m_resolver)
+			m_resolver->Root(nullptr);
+		m_resolver				= std::move(config.m_resolver);
+		if (m_resolver)
+			m_resolver->Root(&m_root);
+		m_locations				= std::move(config.m_locations);
+		m_arena					= std::move(config.m_arena);
+	}
+	return *this;
+}
+
+Config::~Config() noexcept {
+	// Items still alive elsewhere can no longer resolve their references
+	if (m_resolver)
+		m_resolver->Root(nullptr);
+	// Items can be built in the arena which is destroyed before the root
+	m_root.Clear();
+}
 
 Config& Config::operator<<(const Config& source) {
 	// We will not use serialize for performance reasons
 	for (const auto& item: source.Items())
-		Add(*item->Clone());
-		
+		m_root.Add(item->Clone(), m_on_existing_action);
+	Retain(source);
+
 	return *this;
 }
 
 void Config::operator<<(std::istream& istream) { // 1
-	auto res = Parser::Parse(istream, m_root, m_on_existing_action, m_before_read_hooks, m_after_read_hooks, m_on_parse_failure_hook);
+	auto res = Parser::Parse(istream, m_root, m_on_existing_action, m_on_comment_action, ParseContext(), m_parse_mode, m_before_read_hooks, m_after_read_hooks, m_on_parse_failure_hook);
 	if (!res)
 		throw *res.error();
 }
 
-void Config::operator<<(const std::string& str) { // 2
-	auto res = Parser::Parse(str, m_root, m_on_existing_action, m_before_read_hooks, m_after_read_hooks, m_on_parse_failure_hook);
+void Config::operator<<(std::string_view str) { // 2
+	auto res = Parser::Parse(str, m_root, m_on_existing_action, m_on_comment_action, ParseContext(), m_parse_mode, m_before_read_hooks, m_after_read_hooks, m_on_parse_failure_hook);
 	if (!res)
 		throw *res.error();
 }
 
+void Config::LoadFile(const std::filesystem::path& path) {
+	// Mapped file is retained instead of copied by lazily parsed containers
+	auto res = Parser::Parse(Parser::Source::FromFile(path), m_root, m_on_existing_action, m_on_comment_action, ParseContext(), m_parse_mode, m_before_read_hooks, m_after_read_hooks, m_on_parse_failure_hook);
+	if (!res)
+		throw *res.error();
+}
+
+Task<StormByte::Expected<void, ParseError>> Config::LoadAsync(std::istream& istream, Executor& executor, std::size_t slice) {
+	// Nothing is done on the calling thread
+	co_await executor.Schedule();
+
+	for (const auto& hook: m_before_read_hooks)
+		hook(m_root);
+
+	Expected<void, ParseError> res;
+	try {
+		Parser::Builder builder(m_root, m_on_existing_action, m_on_comment_action, nullptr, ParseContext());
+		IncrementalParser parser(builder);
+		// Nothing would ever be read in empty slices
+		slice = std::max<std::size_t>(slice, 1);
+		std::string chunk(slice, '\0');
+		while (istream.read(chunk.data(), static_cast<std::streamsize>(slice)) || istream.gcount() > 0) {
+			parser.Feed(std::span<const char>(chunk.data(), static_cast<std::size_t>(istream.gcount())));
+			co_await executor.Schedule();
+		}
+		parser.Finish();
+	}
+	catch (const ParseError& e) {
+		res = Unexpected(std::make_shared<ParseError>(e));
+	}
+	co_return Parser::Parser::Conclude(std::move(res), m_root, m_after_read_hooks, m_on_parse_failure_hook);
+}
+
+Task<StormByte::Expected<void, ParseError>> Config::LoadAsync(std::string_view buffer, Executor& executor, std::size_t slice) {
+	std::ispanstream istream(std::span<const char>(buffer.data(), buffer.size()));
+	co_return co_await LoadAsync(istream, executor, slice);
+}
+
+std::vector<StormByte::Expected<Config, Exception>> Config::LoadMany(const std::vector<std::filesystem::path>& paths, const MergeMode& merge, const std::size_t& threads) {
+	return LoadMany(paths.size(), [&paths](Config& config, const std::size_t& index) { config.LoadFile(paths[index]); }, merge, threads);
+}
+
+std::vector<StormByte::Expected<Config, Exception>> Config::ParseMany(const std::vector<std::string_view>& buffers, const MergeMode& merge, const std::size_t& threads) {
+	return LoadMany(buffers.size(), [&buffers](Config& config, const std::size_t& index) { config << buffers[index]; }, merge, threads);
+}
+
+std::optional<Location> Config::SourceLocation(const std::string& path) const {
+	const Item::Base& item = m_root[path];
+	return m_locations ? m_locations->Find(item) : std::nullopt;
+}
+
+void Config::ClearIncludeCache() noexcept {
+	Parser::FragmentCache::Instance().Clear();
+}
+
+Parser::Context Config::ParseContext() {
+	if (m_reference_mode == ReferenceMode::Resolve && !m_resolver)
+		m_resolver = std::make_shared<Item::Resolver>(&m_root);
+	if (m_location_mode == LocationMode::Keep && !m_locations)
+		m_locations = std::make_shared<Parser::Locations>();
+	if ((m_allocation_mode == AllocationMode::Arena || m_string_mode == StringMode::View) && !m_arena)
+		m_arena = std::make_shared<Parser::Arena>();
+	return { m_reference_mode == ReferenceMode::Resolve ? m_resolver : nullptr, m_location_mode == LocationMode::Keep ? m_locations : nullptr, nullptr, m_allocation_mode == AllocationMode::Arena ? m_arena : nullptr, m_list_mode, m_pack_mode, m_string_mode == StringMode::View ? m_arena : nullptr, {} };
+}
+
+void Config::Retain(const Config& config) {
+	// Its items (or the ones shared by their clones) can be built in its arena or view sources it keeps
+	if (config.m_arena && config.m_arena != m_arena) {
+		if (!m_arena)
+			m_arena = std::make_shared<Parser::Arena>();
+		m_arena->Retain(config.m_arena);
+	}
+	// Its items resolve their references from this configuration (copying the ones it shares)
+	if (config.m_resolver && config.m_resolver != m_resolver) {
+		if (!m_resolver)
+			m_resolver = std::make_shared<Item::Resolver>(&m_root);
+		m_root.References(m_resolver);
+	}
+}
+
+Config Config::EmptyCopy() const {
+	Config config;
+	config.m_before_read_hooks		= m_before_read_hooks;
+	config.m_after_read_hooks		= m_after_read_hooks;
+	config.m_on_parse_failure_hook	= m_on_parse_failure_hook;
+	config.m_on_existing_action		= m_on_existing_action;
+	config.m_on_comment_action		= m_on_comment_action;
+	config.m_parse_mode				= m_parse_mode;
+	config.m_list_mode				= m_list_mode;
+	config.m_allocation_mode		= m_allocation_mode;
+	config.m_string_mode			= m_string_mode;
+	config.m_reference_mode			= m_reference_mode;
+	config.m_location_mode			= m_location_mode;
+	config.m_pack_mode				= m_pack_mode;
+	return config;
+}
+
+std::vector<StormByte::Expected<Config, Exception>> Config::LoadMany(const std::size_t& count, const std::function<void(Config&, const std::size_t&)>& load, const MergeMode& merge, const std::size_t& threads) {
+	std::vector<Expected<Config, Exception>> results(count);
+	const std::function<void(std::size_t)> task = [this, &load, &results](std::size_t index) {
+		Config config = EmptyCopy();
+		try {
+			load(config, index);
+			results[index] = std::move(config);
+		}
+		catch (const ParseError& e) {
+			results[index] = Unexpected(std::make_shared<ParseError>(e));
+		}
+		catch (const FileIOError& e) {
+			results[index] = Unexpected(std::make_shared<FileIOError>(e));
+		}
+		catch (const Exception& e) {
+			results[index] = Unexpected(std::make_shared<Exception>(e));
+		}
+		catch (...) {
+			results[index] = Unexpected(std::make_shared<Exception>("Unknown error loading input " + std::to_string(index)));
+		}
+	};
+
+	if (threads == 0)
+		Parser::ThreadPool::Default().ForEach(count, task);
+	else {
+		// Caller thread also runs tasks
+		Parser::ThreadPool pool(threads - 1);
+		pool.ForEach(count, task);
+	}
+
+	// Merge is done sequentially so it is ordered
+	if (merge == MergeMode::None)
+		return results;
+	for (auto& result: results) {
+		if (!result)
+			continue;
+
+		// Every item of an input is added or none is (names within an input were already checked)
+		if (m_on_existing_action == OnExistingAction::ThrowException) {
+			const auto items = std::as_const(*result).Items();
+			const auto repeated = std::find_if(items.begin(), items.end(), [this](const Item::Base::PointerType& item) {
+				return item->Name() && m_root.Exists(*item->Name());
+			});
+			if (repeated != items.end()) {
+				result = Unexpected(std::make_shared<ItemNameAlreadyExists>(*(*repeated)->Name()));
+				continue;
+			}
+		}
+
+		if (merge == MergeMode::Move) {
+			for (auto& item: result->Items())
+				m_root.Add(std::move(item), m_on_existing_action);
+			result->Clear();
+		}
+		else {
+			for (const auto& item: std::as_const(*result).Items())
+				m_root.Add(item, m_on_existing_action);
+		}
+		Retain(*result);
+	}
+	return results;
+}
+
 Config& StormByte::Config::operator>>(std::istream& istream, Config& config) { // 3
 	config << istream;
 	return config;
 }
 
-Config& StormByte::Config::operator>>(const std::string& str, Config& config) { // 4
+Config& StormByte::Config::operator>>(std::string_view str, Config& config) { // 4
 	config << str;
 	return config;
 }
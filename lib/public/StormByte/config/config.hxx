@@ -1,17 +1,38 @@
 #pragma once
 
 #include <StormByte/config/alias.hxx>
+#include <StormByte/config/executor.hxx>
+#include <StormByte/config/handler.hxx>
+#include <StormByte/config/incremental_parser.hxx>
 #include <StormByte/config/item/value.hxx>
 #include <StormByte/config/item/comment.hxx>
 #include <StormByte/config/item/group.hxx>
+#include <StormByte/config/item/hash.hxx>
 #include <StormByte/config/item/list.hxx>
+#include <StormByte/config/item/visit.hxx>
+#include <StormByte/config/location.hxx>
+#include <StormByte/config/reader.hxx>
+#include <StormByte/config/task.hxx>
 #include <StormByte/config/type.hxx>
 
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
 /**
  * @namespace Config
  * @brief All the classes for handling configuration files and items
  */
 namespace StormByte::Config {
+	namespace Parser {
+		// Forwards
+		class Arena;
+		class Locations;
+		struct Context;
+	}
+
 	/**
 	 * @class Config
 	 * @brief Abstract class for a configuration file
@@ -35,35 +56,40 @@ namespace StormByte::Config {
 
 			/**
 			 * Copy constructor
+			 *
+			 * Items are shared until one of the configurations changes them (copy on write, see
+			 * Item::Container), so copying does not depend on their number. The copy resolves
+			 * references from its own items: the containers holding string values with them
+			 * are copied along with those values.
 			 * @param config configuration to copy
 			 */
-			Config(const Config& config)							= default;
+			Config(const Config& config);
 
 			/**
 			 * Move constructor
 			 * @param config configuration to move
 			 */
-			Config(Config&& config) noexcept						= default;
+			Config(Config&& config) noexcept;
 
 			/**
 			 * Assignment operator
 			 * @param config configuration to assign
 			 */
-			Config& operator=(const Config& config)					= default;
+			Config& operator=(const Config& config);
 
 			/**
 			 * Move assignment operator
 			 * @param config configuration to move
 			 */
-			Config& operator=(Config&& config) noexcept				= default;
+			Config& operator=(Config&& config) noexcept;
 
 			/**
 			 * Destructor
 			 */
-			virtual ~Config()										= default;
+			virtual ~Config() noexcept;
 
 			/**
-			 * Gets a reference to item by path
+			 * Gets a reference to item by path (copied first along with its parents if shared with a copy)
 			 * @param path path to item
 			 * @return item reference
 			 */
@@ -81,7 +107,7 @@ namespace StormByte::Config {
 			}
 
 			/**
-			 * Gets a reference to item by index
+			 * Gets a reference to item by index (copied first if shared with a copy)
 			 * @param index index of item
 			 * @throw OutOfBounds if index is out of bounds
 			 * @return item reference
@@ -121,6 +147,8 @@ namespace StormByte::Config {
 			/* INPUT */
 			/**
 			 * Take data from another configuration
+			 *
+			 * Its items are shared until either configuration changes them (see Item::Container).
 			 * @param source source configuration to import
 			 * @return Reference to configuration
 			 */
@@ -134,9 +162,74 @@ namespace StormByte::Config {
 
 			/**
 			 * Initialize configuration with a string
-			 * @param str input string
+			 * @param str input string (it is parsed in place, and only copied when kept: in lazy mode, when keeping locations or viewed by strings)
+			 */
+			void 													operator<<(std::string_view str); // 2
+
+			/**
+			 * Initialize configuration from a file
+			 *
+			 * Regular files are memory mapped and parsed in place while pipes and
+			 * other special files are read into a buffer first. Mappings are only kept
+			 * when needed after loading (lazy mode, locations or string views), and the
+			 * file must not be truncated while they are.
+			 * @param path file path
+			 * @throw FileIOError if file can not be read
+			 * @throw ParseError if file contents can not be parsed
 			 */
-			void 													operator<<(const std::string& str); // 2
+			void 													LoadFile(const std::filesystem::path& path);
+
+			/**
+			 * Initializes configuration from a stream without blocking
+			 *
+			 * Input is read and parsed in slices and the coroutine yields to the executor between
+			 * them, so an event loop can keep serving while a big file is loaded. Hooks run in the
+			 * same order than when loading synchronously. Parse mode is not applied as everything
+			 * is parsed slice by slice. The stream and this configuration have to outlive the task.
+			 * @param istream input stream
+			 * @param executor executor resuming the coroutine between slices
+			 * @param slice maximum number of bytes parsed before yielding (at least 1 is parsed)
+			 * @return task resulting in void or parse error
+			 */
+			Task<Expected<void, ParseError>> 						LoadAsync(std::istream& istream, Executor& executor, std::size_t slice = 64 * 1024);
+
+			/**
+			 * Initializes configuration from a buffer without blocking
+			 * @param buffer input buffer (it has to outlive the task)
+			 * @param executor executor resuming the coroutine between slices
+			 * @param slice maximum number of bytes parsed before yielding (at least 1 is parsed)
+			 * @return task resulting in void or parse error
+			 * @see LoadAsync(std::istream&, Executor&, std::size_t)
+			 */
+			Task<Expected<void, ParseError>> 						LoadAsync(std::string_view buffer, Executor& executor, std::size_t slice = 64 * 1024);
+
+			/**
+			 * Loads several files concurrently
+			 *
+			 * Every file is loaded into its own configuration with the settings (actions, parse mode
+			 * and hooks) of this one, so hooks have to be safe to be run from several threads.
+			 * An error in one file does not stop the others from being loaded.
+			 *
+			 * When merging, the items of every loaded file are added to this configuration in the
+			 * given order following OnExistingAction. Either all the items of a file are added or
+			 * none is: a name already in this configuration with OnExistingAction::ThrowException
+			 * leaves it unchanged and replaces that file's result with ItemNameAlreadyExists.
+			 * @param paths file paths
+			 * @param merge how the loaded items are added to this configuration
+			 * @param threads number of threads to use (0 for one per hardware thread)
+			 * @return loaded configuration or error for each file, in the same order
+			 */
+			std::vector<Expected<Config, Exception>> 				LoadMany(const std::vector<std::filesystem::path>& paths, const MergeMode& merge = MergeMode::None, const std::size_t& threads = 0);
+
+			/**
+			 * Parses several buffers concurrently
+			 * @param buffers input buffers (they are only copied when kept, see operator<<(std::string_view))
+			 * @param merge how the parsed items are added to this configuration
+			 * @param threads number of threads to use (0 for one per hardware thread)
+			 * @return parsed configuration or error for each buffer, in the same order
+			 * @see LoadMany
+			 */
+			std::vector<Expected<Config, Exception>> 				ParseMany(const std::vector<std::string_view>& buffers, const MergeMode& merge = MergeMode::None, const std::size_t& threads = 0);
 
 			/**
 			 * Initializes configuration with istream (when istream is in the left part)
@@ -150,7 +243,7 @@ namespace StormByte::Config {
 			 * @param str input string
 			 * @param file Config to put data to
 			 */
-			friend STORMBYTE_CONFIG_PUBLIC Config&					operator>>(const std::string& str, Config& file); // 4
+			friend STORMBYTE_CONFIG_PUBLIC Config&					operator>>(std::string_view str, Config& file); // 4
 			
 			/* OUTPUT */
 			/**
@@ -254,6 +347,106 @@ namespace StormByte::Config {
 				m_on_existing_action = on_existing;
 			}
 
+			/**
+			 * Sets what to do with comments when parsing
+			 *
+			 * Discarded comments are skipped without creating any item, saving memory and
+			 * making lookups shorter, but they are lost when serializing back.
+			 * @param on_comment action for comments
+			 */
+			constexpr void											OnCommentAction(const OnCommentAction& on_comment) {
+				m_on_comment_action = on_comment;
+			}
+
+			/**
+			 * Sets how nested groups and lists are parsed when loading
+			 *
+			 * In lazy mode their contents are only bracket matched and parsed when first
+			 * accessed, retaining the loaded text meanwhile. Syntax errors inside them are
+			 * then reported by the access.
+			 * @param mode parse mode
+			 */
+			constexpr void											ParseMode(const ParseMode& mode) {
+				m_parse_mode = mode;
+			}
+
+			/**
+			 * Sets how parsed items are added to lists
+			 *
+			 * Unique lists check every item against the existing ones (following the action
+			 * set with OnExistingAction), appending lists skip the check for the fastest loading.
+			 * @param mode list mode
+			 */
+			constexpr void											ListMode(const ListMode& mode) {
+				m_list_mode = mode;
+			}
+
+			/**
+			 * Sets where parsed items are allocated
+			 *
+			 * In arena mode items (along with their reference counts) are bump allocated in
+			 * memory owned by the configuration and its copies, which is released at once
+			 * when the last of them is destroyed; removed items are not reclaimed until then.
+			 * Item pointers taken from the configuration (or containers cloned from it, as they
+			 * share their items until changed) must not be kept past that point; configurations they are
+			 * added to with operator<< or LoadMany keep the arena alive. Items added by code
+			 * are not affected.
+			 * @param mode allocation mode
+			 */
+			constexpr void											AllocationMode(const AllocationMode& mode) {
+				m_allocation_mode = mode;
+			}
+
+			/**
+			 * Sets how parsed strings are stored
+			 *
+			 * In view mode the parsed text is kept by the configuration (mapped files are not
+			 * even copied) and strings and comments without escape sequences view it until they
+			 * are read or modified as std::string, so loading does not copy them; read them with
+			 * Item::Base::View to keep it so. The text is kept with the same rules as the arena of
+			 * AllocationMode::Arena.
+			 * @param mode string mode
+			 */
+			constexpr void											StringMode(const StringMode& mode) {
+				m_string_mode = mode;
+			}
+
+			/**
+			 * Sets what ${path} means in parsed string values
+			 *
+			 * In resolve mode it references another item by its path from the root, and
+			 * Item::Base::Resolved replaces it with the item value (use $${ for a literal ${).
+			 * Reading strings through Value<std::string> always gets them as written.
+			 * @param mode reference mode
+			 */
+			constexpr void											ReferenceMode(const ReferenceMode& mode) {
+				m_reference_mode = mode;
+			}
+
+			/**
+			 * Sets what is kept about where parsed items are read from (see SourceLocation)
+			 *
+			 * Keeping locations records the offset of every parsed item and keeps the parsed
+			 * text, copying strings and streams (mapped files are kept mapped instead, so they
+			 * must not be truncated meanwhile).
+			 * @param mode location mode
+			 */
+			constexpr void											LocationMode(const LocationMode& mode) {
+				m_location_mode = mode;
+			}
+
+			/**
+			 * Sets how parsed lists of plain values are stored (see Item::List)
+			 *
+			 * In values mode lists of 16 or more integers, doubles or booleans keep their
+			 * values packed. Non const access to their items unpacks the list, while const
+			 * readers (which may run concurrently) read items made once for the values.
+			 * @param mode pack mode
+			 */
+			constexpr void											PackMode(const PackMode& mode) {
+				m_pack_mode = mode;
+			}
+
 			/**
 			 * Sets a function to execute on failure
 			 * @param hook function to execute
@@ -282,23 +475,23 @@ namespace StormByte::Config {
 			 * Gets the number of items in the current level
 			 * @return size_t number of items
 			 */
-			constexpr virtual size_t								Size() const noexcept {
+			inline virtual size_t									Size() const noexcept {
 				return m_root.Size();
 			}
 
 			/**
-			 * Gets the full number of items
+			 * Gets the full number of items (which parses every lazily parsed container)
 			 * @return size_t number of items
 			 */
-			inline virtual size_t									Count() const noexcept {
+			inline virtual size_t									Count() const {
 				return m_root.Count();
 			}
 
 			/**
-			 * Gets the items in the current level
+			 * Gets the items in the current level (the ones shared with a copy are copied first)
 			 * @return span of items
 			 */
-			constexpr std::span<Item::Base::PointerType>			Items() noexcept {
+			inline std::span<Item::Base::PointerType>				Items() {
 				return m_root.Items();
 			}
 
@@ -306,10 +499,31 @@ namespace StormByte::Config {
 			 * Gets the items in the current level
 			 * @return span of items
 			 */
-			constexpr std::span<const Item::Base::PointerType> 		Items() const noexcept {
+			inline std::span<const Item::Base::PointerType> 		Items() const noexcept {
 				return m_root.Items();
 			}
 
+			/**
+			 * Gets where an item was read from
+			 *
+			 * Locations are only known for items parsed with LocationMode::Keep. Only item offsets
+			 * are kept when parsing, lines and columns are computed on the first query (parsed
+			 * contents are kept for it, mapped files are not copied). Items added by code or
+			 * loaded asynchronously have no location.
+			 * @param path path to item
+			 * @throw ItemNotFound if item is not found
+			 * @return location (if known)
+			 */
+			std::optional<Location> 								SourceLocation(const std::string& path) const;
+
+			/**
+			 * Drops the included files parsed so far by any configuration
+			 *
+			 * Included files are parsed once and cached for the whole process, keeping the most
+			 * recently used ones. Items already included are kept by their configurations.
+			 */
+			static void 											ClearIncludeCache() noexcept;
+
 		protected:
 			Item::Group 											m_root;								///< Root group
 
@@ -327,6 +541,56 @@ namespace StormByte::Config {
 			 * the item to be inserted (or might throw to cancel the insert)
 			 */
 			StormByte::Config::OnExistingAction 					m_on_existing_action;				///< Action to take when item name already exists
+
+			StormByte::Config::OnCommentAction 						m_on_comment_action;				///< What to do with comments when parsing
+
+			StormByte::Config::ParseMode 							m_parse_mode;						///< How nested containers are parsed when loading
+
+			StormByte::Config::ListMode 							m_list_mode;						///< How parsed items are added to lists
+
+			StormByte::Config::AllocationMode 						m_allocation_mode;					///< Where parsed items are allocated
+
+			StormByte::Config::StringMode 							m_string_mode;						///< How parsed strings are stored
+
+			StormByte::Config::ReferenceMode 						m_reference_mode;					///< What ${path} means in parsed strings
+
+			StormByte::Config::LocationMode 						m_location_mode;					///< What is kept about where parsed items are read from
+
+			StormByte::Config::PackMode 							m_pack_mode;						///< How parsed lists of plain values are stored
+
+		private:
+			std::shared_ptr<Item::Resolver>							m_resolver;							///< Resolver for references in string values (created when needed)
+			std::shared_ptr<Parser::Locations>						m_locations;						///< Sources the items were read from (created when needed)
+			std::shared_ptr<Parser::Arena>							m_arena;							///< Arena parsed items are built in (created when needed)
+
+			/**
+			 * Gets what parsed items are attached to
+			 * @return context for this configuration
+			 */
+			Parser::Context 										ParseContext();
+
+			/**
+			 * Keeps the arena of another configuration alive as long as this one, and resolves
+			 * the references of its items from this one
+			 * @param config configuration whose items (or their clones) were added
+			 */
+			void 													Retain(const Config& config);
+
+			/**
+			 * Creates an empty configuration with the same settings
+			 * @return empty configuration
+			 */
+			Config 													EmptyCopy() const;
+
+			/**
+			 * Loads several inputs concurrently
+			 * @param count number of inputs
+			 * @param load function loading an input into an empty configuration
+			 * @param merge how the loaded items are added to this configuration
+			 * @param threads number of threads to use (0 for one per hardware thread)
+			 * @return loaded configuration or error for each input
+			 */
+			std::vector<Expected<Config, Exception>> 				LoadMany(const std::size_t& count, const std::function<void(Config&, const std::size_t&)>& load, const MergeMode& merge, const std::size_t& threads);
 	};
 	/**
 	 * Initializes configuration with istream (when istream is in the left part)
@@ -340,7 +604,7 @@ namespace StormByte::Config {
 	 * @param str input string
 	 * @param file Config to put data to
 	 */
-	STORMBYTE_CONFIG_PUBLIC Config&									operator>>(const std::string& str, Config& file);
+	STORMBYTE_CONFIG_PUBLIC Config&									operator>>(std::string_view str, Config& file);
 
 	/**
 	 * Output configuration serialized to output stream (when output stream is in the left part)
@@ -22,6 +22,9 @@ Exception("Invalid path " + path + " given") {}
 ParseError::ParseError(const unsigned int& line, const std::string& reason):
 Exception("Parse error on line " + std::to_string(line) + ": " + reason) {}
 
+FileIOError::FileIOError(const std::string& path, const std::string& reason):
+Exception("Can not read file " + path + ": " + reason) {}
+
 ItemNotFound::ItemNotFound(const std::string& name):
 Exception("Item " + name + " do not exist") {}
 
@@ -245,6 +245,45 @@ namespace StormByte::Config {
 			~ParseError() noexcept override				= default;
 	};
 
+	/**
+	 * @class FileIOError
+	 * @brief Thrown when a configuration file can not be read
+	 */
+	class STORMBYTE_CONFIG_PUBLIC FileIOError final: public Exception {
+		public:
+			/**
+			 * Constructor
+			 * @param path the file path
+			 * @param reason the error reason
+			 */
+			FileIOError(const std::string& path, const std::string& reason);
+
+			/**
+			 * Copy constructor
+			 */
+			FileIOError(const FileIOError&)				= default;
+
+			/**
+			 * Move constructor
+			 */
+			FileIOError(FileIOError&&)					= default;
+
+			/**
+			 * Assignment operator
+			 */
+			FileIOError& operator=(const FileIOError&)	= default;
+
+			/**
+			 * Move assignment operator
+			 */
+			FileIOError& operator=(FileIOError&&)		= default;
+
+			/**
+			 * Destructor
+			 */
+			~FileIOError() noexcept override			= default;
+	};
+
 	/**
 	 * @class ItemNotFound
 	 * @brief Exception thrown lookup path fails
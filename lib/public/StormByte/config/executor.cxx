@@ -0,0 +1,37 @@
+#include <StormByte/config/executor.hxx>
+
+using namespace StormByte::Config;
+
+ThreadExecutor::ThreadExecutor():m_stopping(false), m_thread(&ThreadExecutor::Run, this) {}
+
+ThreadExecutor::~ThreadExecutor() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_posted.notify_one();
+	m_thread.join();
+}
+
+void ThreadExecutor::Post(std::coroutine_handle<> handle) {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push_back(handle);
+	}
+	m_posted.notify_one();
+}
+
+void ThreadExecutor::Run() {
+	while (true) {
+		std::coroutine_handle<> handle;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_posted.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+			if (m_queue.empty())
+				return;
+			handle = m_queue.front();
+			m_queue.pop_front();
+		}
+		handle.resume();
+	}
+}
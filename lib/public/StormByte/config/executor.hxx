@@ -0,0 +1,133 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @class Executor
+	 * @brief Resumes suspended coroutines, used by asynchronous loading to yield between slices
+	 *
+	 * An event loop only has to implement Post queueing the handle and resuming it from its
+	 * own thread when it is idle.
+	 */
+	class STORMBYTE_CONFIG_PUBLIC Executor {
+		public:
+			/**
+			 * @struct Awaiter
+			 * @brief Awaitable which suspends the coroutine posting it to the executor
+			 */
+			struct Awaiter {
+				Executor& executor;											///< Executor to post to
+
+				/**
+				 * Never ready so the coroutine always yields
+				 * @return false
+				 */
+				constexpr bool 												await_ready() const noexcept {
+					return false;
+				}
+
+				/**
+				 * Posts the suspended coroutine to the executor
+				 * @param handle suspended coroutine
+				 */
+				inline void 												await_suspend(std::coroutine_handle<> handle) {
+					executor.Post(handle);
+				}
+
+				/**
+				 * Nothing is returned on resume
+				 */
+				constexpr void 												await_resume() const noexcept {}
+			};
+
+			/**
+			 * Constructor
+			 */
+			Executor() noexcept											= default;
+
+			/**
+			 * Copy constructor
+			 */
+			Executor(const Executor&)									= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Executor(Executor&&)										= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			Executor& operator=(const Executor&)						= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Executor& operator=(Executor&&)								= delete;
+
+			/**
+			 * Destructor
+			 */
+			virtual ~Executor() noexcept								= default;
+
+			/**
+			 * Queues a suspended coroutine to be resumed later
+			 * @param handle suspended coroutine
+			 */
+			virtual void 												Post(std::coroutine_handle<> handle) = 0;
+
+			/**
+			 * Yields the current coroutine until the executor resumes it
+			 * @return awaitable
+			 */
+			inline Awaiter 												Schedule() noexcept {
+				return Awaiter { *this };
+			}
+	};
+
+	/**
+	 * @class ThreadExecutor
+	 * @brief Executor resuming coroutines in order from its own thread
+	 */
+	class STORMBYTE_CONFIG_PUBLIC ThreadExecutor final: public Executor {
+		public:
+			/**
+			 * Constructor (starts the thread)
+			 */
+			ThreadExecutor();
+
+			/**
+			 * Destructor (resumes every queued coroutine and joins the thread)
+			 */
+			~ThreadExecutor() noexcept override;
+
+			/**
+			 * Queues a suspended coroutine to be resumed from the executor thread
+			 * @param handle suspended coroutine
+			 */
+			void 														Post(std::coroutine_handle<> handle) override;
+
+		private:
+			std::deque<std::coroutine_handle<>> m_queue;				///< Coroutines waiting to be resumed
+			std::mutex m_mutex;											///< Mutex for the queue
+			std::condition_variable m_posted;							///< Notified when a coroutine is posted or on stop
+			bool m_stopping;											///< Thread has to exit once the queue is empty
+			std::thread m_thread;										///< Thread resuming the coroutines
+
+			/**
+			 * Thread loop
+			 */
+			void 														Run();
+	};
+}
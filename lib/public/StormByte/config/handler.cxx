@@ -0,0 +1,38 @@
+#include <StormByte/config/handler.hxx>
+#include <StormByte/config/incremental_parser.hxx>
+#include <StormByte/config/parser/parser.hxx>
+
+using namespace StormByte::Config;
+
+void Handler::OnGroupBegin(std::string_view) {}
+
+void Handler::OnListBegin(std::string_view) {}
+
+void Handler::OnEnd(const Item::ContainerType&) {}
+
+void Handler::OnValue(std::string_view, int) {}
+
+void Handler::OnValue(std::string_view, double) {}
+
+void Handler::OnValue(std::string_view, bool) {}
+
+void Handler::OnValue(std::string_view, std::string_view) {}
+
+void Handler::OnComment(const Item::CommentType&, std::string_view) {}
+
+void Handler::OnInclude(std::string_view) {}
+
+void StormByte::Config::Parse(std::string_view buffer, Handler& handler) {
+	auto res = Parser::Parser::Parse(buffer, handler);
+	if (!res)
+		throw *res.error();
+}
+
+void StormByte::Config::Parse(std::istream& istream, Handler& handler) {
+	// Streams are parsed in chunks as they are read so they are never buffered whole
+	IncrementalParser parser(handler);
+	char chunk[64 * 1024];
+	while (istream.read(chunk, sizeof(chunk)) || istream.gcount() > 0)
+		parser.Feed(std::span<const char>(chunk, static_cast<std::size_t>(istream.gcount())));
+	parser.Finish();
+}
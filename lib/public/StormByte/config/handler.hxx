@@ -0,0 +1,141 @@
+#pragma once
+
+#include <StormByte/config/exception.hxx>
+#include <StormByte/config/item/type.hxx>
+
+#include <istream>
+#include <string_view>
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @class Handler
+	 * @brief Receives parse events without building any item tree
+	 *
+	 * Events are emitted in document order and every method does nothing by default
+	 * so only the needed ones have to be overriden. Names and values are views that are
+	 * only valid during the call, they have to be copied if they are needed later.
+	 * Items inside lists are unnamed so they receive an empty name.
+	 * @code
+	 * class PortFinder: public Handler {
+	 * 	public:
+	 * 		void OnValue(std::string_view name, int value) override {
+	 * 			if (name == "port") port = value;
+	 * 		}
+	 * 		int port = 0;
+	 * };
+	 * @endcode
+	 */
+	class STORMBYTE_CONFIG_PUBLIC Handler {
+		public:
+			/**
+			 * Constructor
+			 */
+			Handler() noexcept										= default;
+
+			/**
+			 * Copy constructor
+			 */
+			Handler(const Handler&)									= default;
+
+			/**
+			 * Move constructor
+			 */
+			Handler(Handler&&) noexcept								= default;
+
+			/**
+			 * Assignment operator
+			 */
+			Handler& operator=(const Handler&)						= default;
+
+			/**
+			 * Move assignment operator
+			 */
+			Handler& operator=(Handler&&) noexcept					= default;
+
+			/**
+			 * Destructor
+			 */
+			virtual ~Handler() noexcept								= default;
+
+			/**
+			 * Called when a group starts
+			 * @param name group name
+			 */
+			virtual void 											OnGroupBegin(std::string_view name);
+
+			/**
+			 * Called when a list starts
+			 * @param name list name
+			 */
+			virtual void 											OnListBegin(std::string_view name);
+
+			/**
+			 * Called when the current group or list ends
+			 * @param type ending container type
+			 */
+			virtual void 											OnEnd(const Item::ContainerType& type);
+
+			/**
+			 * Called for an integer item
+			 * @param name item name
+			 * @param value item value
+			 */
+			virtual void 											OnValue(std::string_view name, int value);
+
+			/**
+			 * Called for a double item
+			 * @param name item name
+			 * @param value item value
+			 */
+			virtual void 											OnValue(std::string_view name, double value);
+
+			/**
+			 * Called for a bool item
+			 * @param name item name
+			 * @param value item value
+			 */
+			virtual void 											OnValue(std::string_view name, bool value);
+
+			/**
+			 * Called for a string item
+			 * @param name item name
+			 * @param value item value (with escape sequences already resolved)
+			 */
+			virtual void 											OnValue(std::string_view name, std::string_view value);
+
+			/**
+			 * Called for a comment
+			 * @param type comment type
+			 * @param text comment text (without the comment delimiters)
+			 */
+			virtual void 											OnComment(const Item::CommentType& type, std::string_view text);
+
+			/**
+			 * Called for an include directive (the included file is not read unless the handler does it)
+			 * @param path included path as written (with escape sequences already resolved)
+			 */
+			virtual void 											OnInclude(std::string_view path);
+	};
+
+	/**
+	 * Parses a configuration emitting events to a handler
+	 * @param buffer input buffer
+	 * @param handler handler to receive the events
+	 * @throw ParseError if parse errors are found
+	 */
+	STORMBYTE_CONFIG_PUBLIC void 									Parse(std::string_view buffer, Handler& handler);
+
+	/**
+	 * Parses a configuration emitting events to a handler
+	 *
+	 * The stream is parsed in chunks as it is read, so it does not need to be seekable.
+	 * @param istream input stream
+	 * @param handler handler to receive the events
+	 * @throw ParseError if parse errors are found
+	 */
+	STORMBYTE_CONFIG_PUBLIC void 									Parse(std::istream& istream, Handler& handler);
+}
@@ -0,0 +1,141 @@
+#include <StormByte/config/incremental_parser.hxx>
+#include <StormByte/config/parser/parser.hxx>
+#include <StormByte/config/parser/scanner.hxx>
+
+using namespace StormByte::Config;
+
+IncrementalParser::IncrementalParser(Handler& handler):
+m_handler(&handler), m_retry_size(0) {
+	Reset();
+}
+
+IncrementalParser::IncrementalParser(IncrementalParser&&) noexcept 				= default;
+
+IncrementalParser& IncrementalParser::operator=(IncrementalParser&&) noexcept 	= default;
+
+IncrementalParser::~IncrementalParser() noexcept 								= default;
+
+void IncrementalParser::Feed(std::span<const char> chunk) {
+	m_pending.append(chunk.data(), chunk.size());
+	// Only the new bytes are scanned, the kept ones are read again once they could hold a token
+	Scan(std::string_view(chunk.data(), chunk.size()), m_tail);
+	if (m_tail.complete || (m_tail.within == Within::Code && m_pending.size() >= m_retry_size))
+		Parse(false);
+}
+
+void IncrementalParser::Finish() {
+	Parse(true);
+	Reset();
+}
+
+void IncrementalParser::Parse(const bool& last) {
+	auto res = m_parser->Resume(m_pending, last);
+	if (!res) {
+		Reset();
+		throw *res.error();
+	}
+	m_pending.erase(0, res.value());
+	// Unfinished tokens are not read again until a line ends or there is twice as much input so parsing time stays linear
+	m_retry_size = m_pending.size() * 2;
+	m_tail = Tail();
+	Scan(m_pending, m_tail);
+	m_tail.complete = false;
+}
+
+void IncrementalParser::Scan(std::string_view bytes, Tail& tail) noexcept {
+	const char* position = bytes.data();
+	const char* const end = bytes.data() + bytes.size();
+	while (position != end) {
+		switch (tail.within) {
+			case Within::Code: {
+				const char c = *position++;
+				switch (c) {
+					case '\n':
+						if (tail.content)
+							tail.complete = true;
+						tail.content = false;
+						break;
+					case ' ':
+					case '\t':
+					case '\r':
+						break;
+					case '"':
+						tail.within = Within::String;
+						tail.content = true;
+						break;
+					case '#':
+						tail.within = Within::LineComment;
+						tail.content = true;
+						break;
+					case '/':
+					case '*':
+						// Comments start with two characters
+						if (tail.previous == '/') {
+							tail.within = c == '/' ? Within::LineComment : Within::BlockComment;
+							tail.previous = '\0';
+							continue;
+						}
+						tail.content = true;
+						break;
+					default:
+						tail.content = true;
+						break;
+				}
+				tail.previous = c;
+				break;
+			}
+			case Within::String:
+				// Only quotes and escapes matter inside strings, the rest is skipped at once
+				if (tail.escaped) {
+					tail.escaped = false;
+					position++;
+					break;
+				}
+				position = Parser::Scanner::Find(position, end, '"', '\\');
+				if (position == end)
+					break;
+				if (*position++ == '\\')
+					tail.escaped = true;
+				else {
+					tail.within = Within::Code;
+					tail.previous = '"';
+				}
+				break;
+			case Within::LineComment:
+				position = Parser::Scanner::Find(position, end, '\n', '\n');
+				if (position == end)
+					break;
+				position++;
+				tail.within = Within::Code;
+				tail.previous = '\n';
+				tail.complete = true;
+				tail.content = false;
+				break;
+			case Within::BlockComment: {
+				// Closed by "*/", whose star could be the last byte scanned before
+				const char* slash = Parser::Scanner::Find(position, end, '/', '/');
+				const char before = slash == position ? tail.previous : slash[-1];
+				if (slash == end) {
+					tail.previous = end[-1];
+					position = end;
+					break;
+				}
+				position = slash + 1;
+				if (before == '*') {
+					tail.within = Within::Code;
+					tail.previous = '\0';
+				}
+				else
+					tail.previous = '/';
+				break;
+			}
+		}
+	}
+}
+
+void IncrementalParser::Reset() {
+	m_parser.reset(new Parser::Parser(Reader(std::string_view()), *m_handler));
+	m_pending.clear();
+	m_retry_size = 0;
+	m_tail = Tail();
+}
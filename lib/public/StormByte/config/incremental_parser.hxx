@@ -0,0 +1,141 @@
+#pragma once
+
+#include <StormByte/config/exception.hxx>
+#include <StormByte/config/handler.hxx>
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	// Forwards
+	class Parser;
+}
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @class IncrementalParser
+	 * @brief Parses a configuration as it arrives in chunks emitting events to a handler
+	 *
+	 * Chunks can be split anywhere (even inside a string or a comment): the tokens which are
+	 * complete are dispatched as soon as they are fed and only the unfinished one is kept, so
+	 * memory use depends on nesting depth and on the largest token but not on input size.
+	 * When a token spans several chunks only the new bytes are looked at (once each) until
+	 * a line holding something more ends outside strings and comments, so a huge string or
+	 * comment is read once after it is closed. Long lines without line breaks are read again
+	 * once the kept input has doubled, so they are not rescanned for every small chunk.
+	 * @code
+	 * IncrementalParser parser(handler);
+	 * char chunk[4096];
+	 * while (ssize_t size = read(fd, chunk, sizeof(chunk)); size > 0)
+	 * 	parser.Feed(std::span<const char>(chunk, size));
+	 * parser.Finish();
+	 * @endcode
+	 */
+	class STORMBYTE_CONFIG_PUBLIC IncrementalParser {
+		public:
+			/**
+			 * Constructor
+			 * @param handler handler to receive the events (it has to outlive the parser)
+			 */
+			IncrementalParser(Handler& handler);
+
+			/**
+			 * Copy constructor
+			 */
+			IncrementalParser(const IncrementalParser&) 			= delete;
+
+			/**
+			 * Move constructor
+			 */
+			IncrementalParser(IncrementalParser&&) noexcept;
+
+			/**
+			 * Assignment operator
+			 */
+			IncrementalParser& operator=(const IncrementalParser&) 	= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			IncrementalParser& operator=(IncrementalParser&&) noexcept;
+
+			/**
+			 * Destructor
+			 */
+			~IncrementalParser() noexcept;
+
+			/**
+			 * Feeds the next chunk of input
+			 * @param chunk input chunk (it is not needed after the call)
+			 * @throw ParseError if parse errors are found (the parser is reset then)
+			 */
+			void 													Feed(std::span<const char> chunk);
+
+			/**
+			 * Signals the end of the input dispatching the pending tokens
+			 *
+			 * Afterwards the parser is reset so it can be fed a new input.
+			 * @throw ParseError if parse errors are found (like unclosed containers)
+			 */
+			void 													Finish();
+
+		private:
+			/**
+			 * @enum Within
+			 * @brief What a byte of the kept input is part of
+			 */
+			enum class Within: unsigned short {
+				Code,												///< Names, values and brackets
+				String,												///< Quoted string
+				LineComment,										///< Comment until the line break
+				BlockComment										///< Comment until its closing characters
+			};
+
+			/**
+			 * @struct Tail
+			 * @brief What the kept input holds, scanned once per byte
+			 */
+			struct Tail {
+				Within within = Within::Code;						///< What the last byte scanned is part of
+				char previous = '\0';								///< Last byte scanned (for two character delimiters)
+				bool escaped = false;								///< Is the next string byte escaped?
+				bool content = false;								///< Was something other than whitespace scanned since the last line break outside strings and comments?
+				bool complete = false;								///< Did a line holding something end outside strings and comments?
+			};
+
+			Handler* m_handler;										///< Handler receiving the events
+			std::unique_ptr<Parser::Parser> m_parser;				///< Parser keeping the open containers
+			std::string m_pending;									///< Input not consumed yet
+			std::size_t m_retry_size;								///< Pending input size to reach before reading again (outside strings and comments)
+			Tail m_tail;											///< What the pending input holds
+
+			/**
+			 * Parses the pending input
+			 * @param last is it the end of the input?
+			 * @throw ParseError if parse errors are found
+			 */
+			void 													Parse(const bool& last);
+
+			/**
+			 * Scans input bytes after the ones scanned already
+			 * @param bytes input bytes
+			 * @param tail what the input scanned so far holds (updated)
+			 */
+			static void 											Scan(std::string_view bytes, Tail& tail) noexcept;
+
+			/**
+			 * Discards every state to start a new input
+			 */
+			void 													Reset();
+	};
+}
@@ -4,22 +4,60 @@
 #include <StormByte/config/item/comment.hxx>
 #include <StormByte/util/string.hxx>
 
-#include <regex>
-
 using namespace StormByte::Config::Item;
 
-Base::Base(const std::string& name):m_name(name) {}
+namespace {
+	/**
+	 * Checks if a character is an ASCII letter (whatever the locale is)
+	 * @param c character
+	 * @return is letter?
+	 */
+	constexpr bool IsLetter(const char& c) noexcept {
+		return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+	}
+
+	/**
+	 * Checks if a character is an ASCII letter, digit or underscore (whatever the locale is)
+	 * @param c character
+	 * @return is name character?
+	 */
+	constexpr bool IsNameCharacter(const char& c) noexcept {
+		return IsLetter(c) || (c >= '0' && c <= '9') || c == '_';
+	}
+}
+
+Base::Base(const Item::Type& type, std::string_view name):m_name(SymbolTable::Intern(name)), m_type(type) {}
+
+std::string_view Base::View() const {
+	// Comments are string values too
+	if (m_type != Item::Type::String && m_type != Item::Type::Comment)
+		throw WrongValueTypeConversion(TypeToString(), Item::TypeToString(Item::Type::String));
+	return static_cast<const Item::Value<std::string>&>(*this).View();
+}
+
+std::string Base::Resolved() const {
+	// Comments are string values too
+	if (m_type != Item::Type::String && m_type != Item::Type::Comment)
+		throw WrongValueTypeConversion(TypeToString(), Item::TypeToString(Item::Type::String));
+	return static_cast<const Item::Value<std::string>&>(*this).Resolved();
+}
 
 std::string Base::Serialize(const int& indent_level) const noexcept {
 	std::string serialized = Util::String::Indent(indent_level);
-	if (m_name)
-		serialized += *m_name + " = ";
+	if (*m_name)
+		serialized += **m_name + " = ";
 	return serialized;
 }
 
 namespace StormByte::Config::Item {
-	bool IsNameValid(const std::string& name) noexcept {
-		static const std::regex name_regex(R"(^[A-Za-z][A-Za-z0-9_]*$)");
-		return std::regex_match(name, name_regex);
+	bool IsNameValid(std::string_view name) noexcept {
+		// Same as ^[A-Za-z][A-Za-z0-9_]*$ without the cost of a regex match per item
+		if (name.empty() || !IsLetter(name[0]))
+			return false;
+		for (const char& c: name.substr(1)) {
+			if (!IsNameCharacter(c))
+				return false;
+		}
+		return true;
 	}
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <StormByte/config/exception.hxx>
+#include <StormByte/config/item/symbol.hxx>
 #include <StormByte/config/item/type.hxx>
 #include <StormByte/util/templates/clonable.hxx>
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace StormByte::Config::Item {
@@ -20,11 +22,14 @@ namespace StormByte::Config::Item {
 	 * @param name name to check
 	 * @return is name valid?
 	 */
-	bool STORMBYTE_CONFIG_PUBLIC IsNameValid(const std::string&) noexcept;
+	bool STORMBYTE_CONFIG_PUBLIC IsNameValid(std::string_view name) noexcept;
 	
 	/**
 	 * @class Base
 	 * @brief Base class for a configuration item
+	 *
+	 * The item type is kept as a tag so it is known (and values are reached) without
+	 * virtual dispatch, and the name is interned so names are compared by address.
 	 */
 	class STORMBYTE_CONFIG_PUBLIC Base: public Util::Templates::Clonable<Base, std::shared_ptr<Base>> {
 		public:
@@ -32,13 +37,14 @@ namespace StormByte::Config::Item {
 			 * Constructor
 			 * @param type item type
 			 */
-			Base() 											= default;
+			inline Base(const Item::Type& type) noexcept:m_type(type) {}
 
 			/**
 			 * Constructor
+			 * @param type item type
 			 * @param name item name
 			 */
-			Base(const std::string& name);
+			Base(const Item::Type& type, std::string_view name);
 
 			/**
 			 * Copy constructor
@@ -75,7 +81,8 @@ namespace StormByte::Config::Item {
 			 * @return is equal?
 			 */
 			inline bool 									operator==(const Base& base) const noexcept {
-				return m_name == base.m_name;
+				// Unnamed symbol is compared by value in case it is not unique across binaries
+				return m_name == base.m_name || (!*m_name && !*base.m_name);
 			}
 
 			/**
@@ -92,15 +99,23 @@ namespace StormByte::Config::Item {
 			 * @return item name
 			 */
 			constexpr const std::optional<std::string>& 	Name() const noexcept {
+				return *m_name;
+			}
+
+			/**
+			 * Gets the item name symbol
+			 * @return interned name
+			 */
+			constexpr SymbolTable::Symbol 					Symbol() const noexcept {
 				return m_name;
 			}
 
 			/**
 			 * Sets the item name
-			 * @return item name
+			 * @param name item name
 			 */
-			constexpr void 									Name(const std::string& name) noexcept {
-				m_name = name;
+			inline void 									Name(std::string_view name) {
+				m_name = SymbolTable::Intern(name);
 			}
 
 			/**
@@ -108,14 +123,16 @@ namespace StormByte::Config::Item {
 			 * @return is name valid?
 			 */
 			inline bool 									IsNameValid() const noexcept {
-				return m_name.has_value() && Item::IsNameValid(m_name.value());
+				return m_name->has_value() && Item::IsNameValid(**m_name);
 			}
 
 			/**
-			 * Gets the item name
-			 * @return item name
+			 * Gets the item type
+			 * @return item type
 			 */
-			constexpr virtual Type 							Type() const noexcept = 0;
+			constexpr Item::Type 							Type() const noexcept {
+				return m_type;
+			}
 
 			/**
 			 * Gets the item type as string
@@ -131,6 +148,22 @@ namespace StormByte::Config::Item {
 			 */
 			virtual std::string								Serialize(const int& indent_level) const noexcept;
 
+			/**
+			 * Gets a string value (or comment) as written, without copying it
+			 * @throw WrongValueTypeConversion if item is not a string
+			 * @return view of the value (valid until the item is modified or destroyed)
+			 */
+			std::string_view 								View() const;
+
+			/**
+			 * Gets a string value (or comment) with its ${path} references resolved (see ReferenceMode)
+			 * @throw WrongValueTypeConversion if item is not a string
+			 * @throw ItemNotFound if a referenced item is not found
+			 * @throw Exception if a reference is not a value or is part of a cycle
+			 * @return resolved value (as written when its references are not resolved)
+			 */
+			std::string 									Resolved() const;
+
 			/**
 			 * Converts current configuration to string
 			 * @return configuration as string
@@ -148,9 +181,20 @@ namespace StormByte::Config::Item {
 			const T& Value() const {
 				if constexpr (std::is_base_of_v<std::remove_reference_t<decltype(*this)>, T>) {
 					// Direct match: T (e.g., Container, Group, etc.) matches this object type
+					if constexpr (std::is_base_of_v<Container, T>) {
+						if (m_type != Item::Type::Container)
+							throw WrongValueTypeConversion(this->TypeToString(), Item::TypeToString(Item::Type::Container));
+					}
 					return static_cast<const T&>(*this);
 				} else if constexpr (std::is_base_of_v<std::remove_reference_t<decltype(*this)>, Item::Value<T>>) {
-					// Indirect match: T is wrapped inside Item::Value<T>
+					// Indirect match: T is wrapped inside Item::Value<T> (strings are read as written, see Resolved)
+					if constexpr (std::is_same_v<T, std::string>) {
+						// Comments are string values too
+						if (m_type != Item::Type::String && m_type != Item::Type::Comment)
+							throw WrongValueTypeConversion(this->TypeToString(), Item::TypeToString(Item::Type::String));
+					}
+					else if (m_type != TypeOf<T>())
+						throw WrongValueTypeConversion(this->TypeToString(), Item::TypeToString(TypeOf<T>()));
 					return *static_cast<const Item::Value<T>&>(*this);
 				} else {
 					// No valid match: Throw an exception for incorrect conversion
@@ -165,11 +209,18 @@ namespace StormByte::Config::Item {
 			 */
 			template<typename T>
 			T& Value() {
-				return const_cast<T&>(static_cast<const Base&>(*this).Value<T>());
+				if constexpr (std::is_same_v<T, std::string>) {
+					(void)static_cast<const Base&>(*this).Value<T>();
+					// Strings drop their resolved value as they can be changed
+					return *static_cast<Item::Value<T>&>(*this);
+				}
+				else
+					return const_cast<T&>(static_cast<const Base&>(*this).Value<T>());
 			}
 				
 
 		protected:
-			std::optional<std::string> m_name;				///< Item name
+			SymbolTable::Symbol m_name = &SymbolTable::c_unnamed;	///< Item name (interned)
+			Item::Type m_type;								///< Item type
 	};
 }
\ No newline at end of file
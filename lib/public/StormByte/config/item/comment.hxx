@@ -21,13 +21,17 @@ namespace StormByte::Config::Item {
 			 * Constructor
 			 * @param comment comment string
 			 */
-			Comment(const std::string& comment):Value<std::string>(comment) {}
+			Comment(const std::string& comment):Value<std::string>(comment) {
+				m_type = Item::Type::Comment;
+			}
 
 			/**
 			 * Move Constructor
 			 * @param comment comment string
 			 */
-			Comment(std::string&& comment):Value<std::string>(std::move(comment)) {}
+			Comment(std::string&& comment):Value<std::string>(std::move(comment)) {
+				m_type = Item::Type::Comment;
+			}
 
 			/**
 			 * Copy constructor
@@ -65,14 +69,6 @@ namespace StormByte::Config::Item {
 			 */
 			std::string 											Serialize(const int& indent_level) const noexcept override;
 
-			/**
-			 * Gets the item type
-			 * @return item type
-			 */
-			constexpr Item::Type									Type() const noexcept override {
-				return Type::Comment;
-			}
-
 			/**
 			 * Gets the comment string
 			 * @return comment string
@@ -1,26 +1,36 @@
 #include <StormByte/config/item/container.hxx>
+#include <StormByte/config/item/hash.hxx>
+#include <StormByte/config/item/value.hxx>
+#include <StormByte/config/parser/deferred.hxx>
+#include <StormByte/config/parser/parser.hxx>
 #include <StormByte/util/string.hxx>
 
+#include <algorithm>
 #include <regex>
 
 using namespace StormByte::Config::Item;
 
-Container::Container(const std::string& name):Base(name) {}
+Container::Container(const std::string& name):Base(Item::Type::Container, name) {}
 
-Container::Container(std::string&& name):Base(std::move(name)) {}
+Container::Container(std::string&& name):Base(Item::Type::Container, std::move(name)) {}
 
 Base& Container::operator[](const size_t& index) {
-	return const_cast<Base&>(static_cast<const Container&>(*this)[index]);
+	Materialize();
+	if (index >= m_items->size())
+		throw OutOfBounds(index, m_items->size());
+	return Own(index);
 }
 
 const Base& Container::operator[](const size_t& index) const {
-	if (index >= m_items.size())
-		throw OutOfBounds(index, m_items.size());
-	return *m_items[index];
+	const auto& items = Materialize();
+	if (index >= items.size())
+		throw OutOfBounds(index, items.size());
+	return *items[index];
 }
 
 Base& Container::operator[](const std::string& path) {
-	return const_cast<Base&>(static_cast<const Container&>(*this)[path]);
+	auto path_queue = Util::String::Explode(path, '/');
+	return Modify(path_queue);
 }
 
 bool Container::operator==(const Container& container) const noexcept {
@@ -34,36 +44,41 @@ bool Container::operator==(const Container& container) const noexcept {
 		return false;
 	}
 
-	// Compare sizes of `m_items` first
-	if (m_items.size() != container.m_items.size()) {
-		return false;
-	}
-
-	// Compare each item in `m_items`
-	for (size_t i = 0; i < m_items.size(); ++i) {
-		if (m_items[i]->Type() != container.m_items[i]->Type() || *m_items[i] != *container.m_items[i]) {
+	// Compare each item by type, name, value and children (contents which can not be parsed are never equal)
+	try {
+		if (CachedHash() != container.CachedHash())
 			return false;
-		}
+		return Equal(*this, container);
+	}
+	catch (const Exception&) {
+		return false;
 	}
-
-	// All comparisons are equal
-	return true;
 }
 
 Base& Container::Add(Base::PointerType item, const OnExistingAction& on_existing) {
-	Base::PointerType i = this->BeforeAdditionActions(item, on_existing);
-
-	if (i)
-		return *i;
-	else {
-		m_items.push_back(item);
-		return *m_items.back();
-	}
+	Base& added = Insert(std::move(item), on_existing);
+	// A kept item was handed out already
+	if (&added == m_items->back().get())
+		Expose(m_items->size() - 1);
+	return added;
 }
 
 bool Container::Exists(const std::string& path) const {
 	try {
-		LookUp(path);
+		// Packed values are counted without unpacking them
+		const std::size_t separator = path.rfind('/');
+		const Container* container = this;
+		if (separator != std::string::npos) {
+			const Base& parent = *LookUp(path.substr(0, separator));
+			if (parent.Type() != Type::Container)
+				return false;
+			container = &static_cast<const Container&>(parent);
+		}
+		const std::string item_path = path.substr(separator == std::string::npos ? 0 : separator + 1);
+		container->Parse();
+		if (container->m_packed)
+			return Util::String::IsNumeric(item_path) && static_cast<std::size_t>(std::stoi(item_path)) < container->PackedSize();
+		container->LookUp(item_path);
 		return true;
 	} catch(const Exception&) {
 		return false;
@@ -71,9 +86,13 @@ bool Container::Exists(const std::string& path) const {
 }
 
 void Container::Remove(const size_t& index) {
-	if (index >= m_items.size())
-		throw OutOfBounds(index, m_items.size());
-	m_items.erase(m_items.begin() + index);
+	Materialize();
+	if (index >= m_items->size())
+		throw OutOfBounds(index, m_items->size());
+	ForgetHash();
+	auto& items = m_items.Edit();
+	items.erase(items.begin() + index);
+	Reindex();
 }
 
 void Container::Remove(const std::string& path)  {
@@ -83,15 +102,26 @@ void Container::Remove(const std::string& path)  {
 
 std::string Container::Serialize(const int& indent_level) const noexcept {
 	const auto enclosure_characters = EnclosureCharacters(ContainerType());
+	try {
+		// Packed items are written without unpacking them
+		Parse();
+	}
+	catch (const Exception&) {
+		// Contents which can not be parsed are written as they were read
+		return Base::Serialize(indent_level) + std::string(1, enclosure_characters.first) + std::string(m_deferred->body);
+	}
 	std::string serial = Base::Serialize(indent_level) + std::string(1, enclosure_characters.first) + "\n";
 	serial += ContentsToString(indent_level + 1);
 	serial += Util::String::Indent(indent_level) + enclosure_characters.second;
 	return serial;
 }
 
-size_t Container::Count() const noexcept {
+size_t Container::Count() const {
+	Parse();
+	if (m_packed)
+		return PackedSize();
 	size_t count = 0;
-	for (const auto& item : m_items) {
+	for (const auto& item : *m_items) {
 		switch(item->Type()) {
 			case Type::Container:
 				count += 1 + item->Value<Container>().Count();
@@ -104,37 +134,149 @@ size_t Container::Count() const noexcept {
 	return count;
 }
 
+const std::vector<Base::PointerType>& Container::Materialize() const {
+	Parse();
+	// Unpacking here would change the container under readers sharing it
+	return m_packed ? PackedItems() : *m_items;
+}
+
+void Container::Materialize() {
+	Parse();
+	if (m_packed)
+		Unpack();
+}
+
+void Container::Parse() const {
+	if (!m_deferred)
+		return;
+
+	// Reset first so items can be added while parsing
+	const auto deferred = std::move(m_deferred);
+	m_deferred.reset();
+	auto res = Parser::Parser::Materialize(*deferred, const_cast<Container&>(*this));
+	if (!res) {
+		m_packed = false;
+		m_items.Reset();
+		const_cast<Container&>(*this).Reindex();
+		m_deferred = deferred;
+		throw *res.error();
+	}
+}
+
 std::string Container::ContentsToString(const int& indent_level) const noexcept {
 	std::string serial = "";
-	for (const auto& item : m_items)
+	for (const auto& item : *m_items)
 		serial += item->Serialize(indent_level) + "\n";
 	return serial;
 }
 
+std::span<Base::PointerType> Container::Items() {
+	Materialize();
+	if (m_items->empty())
+		return {};
+	auto& items = m_items.Edit();
+	for (std::size_t position = 0; position < items.size(); position++)
+		Own(position);
+	Expose();
+	return std::span(items);
+}
+
+Base& Container::Own(const std::size_t& position) {
+	auto& item = m_items.Edit()[position];
+	if (item.use_count() > 1)
+		item = item->Clone();
+	// Containers on the path to a changed item are handed out by their parents, so only they forget theirs
+	ForgetHash();
+	Expose(position);
+	return *item;
+}
+
+std::size_t Container::CachedHash() const {
+	if (m_hash.name.load(std::memory_order_acquire) == m_name)
+		return m_hash.hash.load(std::memory_order_relaxed);
+	const std::size_t hash = Hash(*this);
+	// Readers taking it at once store the same hash, as nothing changes meanwhile
+	m_hash.hash.store(hash, std::memory_order_relaxed);
+	m_hash.name.store(m_name, std::memory_order_release);
+	return hash;
+}
+
+Base& Container::Insert(Base::PointerType item, const OnExistingAction& on_existing) {
+	Materialize();
+	ForgetHash();
+	if (Resolves(*item))
+		m_references = true;
+	return BeforeAdditionActions(std::move(item), on_existing);
+}
+
+void Container::References(const std::shared_ptr<const Resolver>& resolver) {
+	if (!m_references)
+		return;
+	if (m_deferred) {
+		// Its values are attached when parsed
+		if (m_deferred->context.resolver != resolver) {
+			auto deferred = std::make_shared<Parser::Deferred>(*m_deferred);
+			deferred->context.resolver = resolver;
+			m_deferred = std::move(deferred);
+		}
+		return;
+	}
+	for (std::size_t position = 0; position < m_items->size(); position++) {
+		const Base& item = *(*m_items)[position];
+		if (!Resolves(item))
+			continue;
+		if (item.Type() == Type::Container)
+			static_cast<Container&>(Own(position)).References(resolver);
+		else if (static_cast<const Item::Value<std::string>&>(item).References() != resolver.get())
+			static_cast<Item::Value<std::string>&>(Own(position)).References(resolver);
+	}
+}
+
+bool Container::Resolves(const Base& item) noexcept {
+	switch (item.Type()) {
+		case Type::String:
+			return static_cast<const Item::Value<std::string>&>(item).References() != nullptr;
+		case Type::Container:
+			return static_cast<const Container&>(item).m_references;
+		default:
+			return false;
+	}
+}
+
 bool Container::IsPathValid(const std::string& name) noexcept {
 	static const std::regex name_regex(R"(^[A-Za-z][A-Za-z0-9_]*(/[A-Za-z0-9_]+)*$)");
 	return std::regex_match(name, name_regex);
 }
 
-const Base& Container::LookUp(const std::string& path) const {
+std::vector<Base::PointerType>::const_iterator Container::Find(std::string_view name) const noexcept {
+	// A name never interned can not be in use
+	const SymbolTable::Symbol symbol = SymbolTable::Find(name);
+	return symbol ? Find(symbol) : m_items->end();
+}
+
+std::vector<Base::PointerType>::const_iterator Container::Find(const SymbolTable::Symbol& symbol) const noexcept {
+	return std::find_if(m_items->begin(), m_items->end(), [symbol](const Base::PointerType& item) {
+		return item->Symbol() == symbol;
+	});
+}
+
+const Base::PointerType& Container::LookUp(const std::string& path) const {
 	auto path_queue = Util::String::Explode(path, '/');
 	return LookUp(path_queue);
 }
 
-const Base& Container::LookUp(std::queue<std::string>& path) const {
+const Base::PointerType& Container::LookUp(std::queue<std::string>& path) const {
+	const auto& items = Materialize();
 	const std::string item_path = path.front();
 	path.pop();
 	if (path.size() == 0) {
 		if (Util::String::IsNumeric(item_path)) {
-			return *m_items.at(std::stoi(item_path));
+			return items.at(std::stoi(item_path));
 		}
 		else {
-			const auto it = std::find_if(m_items.begin(), m_items.end(), [&item_path](const Base::PointerType& item) {
-				const auto& name = item->Name();
-				return name && item->Name().value() == item_path;
-			});
-			if (it != m_items.end())
-				return **it;
+			const auto it = Find(item_path);
+			if (it != m_items->end())
+				return *it;
 			else
 				throw ItemNotFound(item_path);
 		}
@@ -151,18 +293,21 @@ const Base& Container::LookUp(std::queue<std::string>& path) const {
 }
 
 void Container::Remove(std::queue<std::string>& path) {
+	Materialize();
 	std::string item_path = path.front();
 	path.pop();
 	if (path.size() == 0) {
 		if (Util::String::IsNumeric(item_path))
 			Remove(std::stoi(item_path));
 		else {
-			const auto it = std::find_if(m_items.begin(), m_items.end(), [&item_path](const Base::PointerType& item) {
-				const auto& name = item->Name();
-				return name && item->Name().value() == item_path;
-			});
-			if (it != m_items.end())
-				m_items.erase(it);
+			const auto it = Find(item_path);
+			if (it != m_items->end()) {
+				const std::size_t position = it - m_items->begin();
+				ForgetHash();
+				auto& items = m_items.Edit();
+				items.erase(items.begin() + position);
+				Reindex();
+			}
 			else
 				throw ItemNotFound(item_path);
 		}
@@ -176,4 +321,34 @@ void Container::Remove(std::queue<std::string>& path) {
 			item.Value<Container>().Remove(path);
 		}
 	}
-}
\ No newline at end of file
+}
+
+Base& Container::Modify(std::queue<std::string>& path) {
+	Materialize();
+	const std::string item_path = path.front();
+	path.pop();
+	std::size_t position;
+	if (Util::String::IsNumeric(item_path)) {
+		position = std::stoi(item_path);
+		// Same exceptions as LookUp
+		if (path.size() == 0)
+			(void)m_items->at(position);
+		else if (position >= m_items->size())
+			throw OutOfBounds(position, m_items->size());
+	}
+	else {
+		const auto it = Find(item_path);
+		if (it == m_items->end())
+			throw ItemNotFound(item_path);
+		position = it - m_items->begin();
+	}
+
+	// Only the items on the path are copied if shared
+	Base& item = Own(position);
+	if (path.size() == 0)
+		return item;
+	else if (item.Type() != Type::Container)
+		throw Exception("Lookup path " + item_path + " applied to non container item");
+	else
+		return static_cast<Container&>(item).Modify(path);
+}
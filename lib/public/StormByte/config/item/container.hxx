@@ -2,21 +2,43 @@
 
 #include <StormByte/config/exception.hxx>
 #include <StormByte/config/item/base.hxx>
+#include <StormByte/config/item/shared.hxx>
 #include <StormByte/config/type.hxx>
 
+#include <atomic>
+#include <memory>
 #include <queue>
 #include <span>
 #include <vector>
 
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	// Forwards
+	class Builder;
+	class Parser;
+	struct Deferred;
+}
+
 /**
  * @namespace Item
  * @brief All the configuration item classes namespace
  */
 namespace StormByte::Config::Item {
+	// Forwards
+	class Resolver;
+
 	/**
 	 * @class Container
 	 * @brief Container class for a container of configuration items
 	 * @tparam T container type
+	 *
+	 * Copies share their items until one of them is changed (copy on write): copying
+	 * does not depend on the number of items, and changing an item through a copy
+	 * (by index, path or Items()) copies only the containers on its path and the item.
+	 * References taken before copying still point to the items shared by both.
 	 */
 	class STORMBYTE_CONFIG_PUBLIC Container: public Base {
 		public:
@@ -24,7 +46,7 @@ namespace StormByte::Config::Item {
 			 * Constructor
 			 * @param type container type
 			 */
-			Container()											= default;
+			inline Container() noexcept:Base(Item::Type::Container) {}
 
 			/**
 			 * Constructor
@@ -68,7 +90,7 @@ namespace StormByte::Config::Item {
 			virtual ~Container() noexcept override				= default;
 
 			/**
-			 * Gets a reference to Item by index
+			 * Gets a reference to Item by index (copied first if shared, see Container)
 			 * @throw OutOfBounds if index is out of bounds
 			 * @return size_t number of items
 			 */
@@ -82,7 +104,7 @@ namespace StormByte::Config::Item {
 			const Base& 										operator[](const size_t& index) const;
 
 			/**
-			 * Gets a reference to Item by path
+			 * Gets a reference to Item by path (copied first along with its parents if shared, see Container)
 			 * @param path path to item
 			 * @throw InvalidPath if path is invalid
 			 * @throw ItemNotFound if item is not found
@@ -98,11 +120,16 @@ namespace StormByte::Config::Item {
 			 * @return Item& item
 			 */
 			inline const Base& 									operator[](const std::string& path) const {
-				return LookUp(path);
+				return *LookUp(path);
 			}
 
 			/**
 			 * Equality operator
+			 *
+			 * Containers whose structural hashes differ are told apart without comparing their
+			 * items. The hash is kept until the container changes an item or hands one out to be
+			 * changed (by index, path or Items()), so take items again from it to change them
+			 * rather than through references kept past a comparison.
 			 * @param container container to compare
 			 * @return is equal?
 			 */
@@ -126,7 +153,7 @@ namespace StormByte::Config::Item {
 			 * @return reference to added item
 			 */
 			inline Base& 										Add(const Base& item, const OnExistingAction& on_existing = OnExistingAction::ThrowException) {
-				return Add(std::move(*item.Clone()), on_existing);
+				return Add(item.Clone(), on_existing);
 			}
 
 			/**
@@ -141,7 +168,10 @@ namespace StormByte::Config::Item {
 			}
 
 			/**
-			 * Adds an item to the container (pointer type, virtual pure)
+			 * Adds an item to the container (pointer type)
+			 *
+			 * Ownership is shared with the given pointer, move it in when it is not needed
+			 * anymore so no reference count is touched.
 			 * @param item item to add
 			 * @param on_existing action to take if item name already exists
 			 * @throw ItemNameAlreadyExists if item name already exists
@@ -153,7 +183,12 @@ namespace StormByte::Config::Item {
 			 * Clears all items
 			 */
 			inline void 										Clear() noexcept {
-				m_items.clear();
+				ForgetHash();
+				m_deferred.reset();
+				m_packed = false;
+				m_references = false;
+				m_items.Reset();
+				Reindex();
 			}
 
 			/**
@@ -212,18 +247,23 @@ namespace StormByte::Config::Item {
 
 			/**
 			 * Get all items in the container
+			 *
+			 * Iterate by reference: copying a pointer shares ownership of the item, which is an
+			 * atomic operation. Packed items are unpacked (see List). Items shared (with a copy of
+			 * the container or by a pointer kept elsewhere) are copied first, see Container.
 			 * @return std::span of items
 			 */
-			constexpr std::span<Base::PointerType> 				Items() noexcept {
-				return std::span(m_items);
-			}
+			std::span<Base::PointerType> 						Items();
 
 			/**
 			 * Get all items in the container
+			 *
+			 * Iterate by reference: copying a pointer shares ownership of the item, which is an
+			 * atomic operation. Packed items are read without unpacking them (see List).
 			 * @return std::span of items
 			 */
-			constexpr std::span<const Base::PointerType> 		Items() const noexcept {
-				return std::span(m_items);
+			inline std::span<const Base::PointerType> 			Items() const {
+				return std::span(Materialize());
 			}
 
 			/**
@@ -241,44 +281,206 @@ namespace StormByte::Config::Item {
 			}
 
 			/**
-			 * Gets the item type
-			 * @return item Type
+			 * Gets the number of items in the current level
+			 * @return size_t number of items
 			 */
-			constexpr Item::Type 								Type() const noexcept override {
-				return Item::Type::Container;
+			inline size_t 										Size() const {
+				Parse();
+				return m_packed ? PackedSize() : m_items->size();
 			}
 
 			/**
-			 * Gets the number of items in the current level
+			 * Gets the full number of items
 			 * @return size_t number of items
 			 */
-			constexpr size_t 									Size() const noexcept {
-				return m_items.size();
+			size_t 												Count() const;
+
+			/**
+			 * Resolves the ${path} references of the string values below with another resolver
+			 *
+			 * Only containers holding such values are visited, and the ones shared with a copy
+			 * (see Container) are copied first, so the copy keeps resolving from its own tree.
+			 * @param resolver resolver of the tree the items belong to now (null to read them as written)
+			 */
+			void 												References(const std::shared_ptr<const Resolver>& resolver);
+
+			/**
+			 * Checks if the contents are still waiting to be parsed (see ParseMode::Lazy)
+			 * @return bool pending?
+			 */
+			inline bool 										IsPending() const noexcept {
+				return m_deferred != nullptr;
 			}
 
+		protected:
+			mutable Shared<std::vector<Base::PointerType>> 		m_items;	///< Items in container (shared by copies until changed, filled on first access when parsed lazily)
+			mutable bool 										m_packed = false;	///< Are items kept packed by the derived class instead of in m_items?
+
 			/**
-			 * Gets the full number of items
+			 * Parses the contents if they were deferred, to read the items
+			 *
+			 * Lazily parsed containers are not safe to be accessed concurrently until this is done.
+			 * @throw ParseError if contents are not valid (they are kept pending)
+			 * @return items to read (made for the packed ones without unpacking them, see PackedItems)
+			 */
+			const std::vector<Base::PointerType>& 				Materialize() const;
+
+			/**
+			 * Parses the contents if they were deferred and unpacks them if they are packed, to change the items
+			 * @throw ParseError if contents are not valid (they are kept pending)
+			 */
+			void 												Materialize();
+
+			/**
+			 * Parses the contents if they were deferred (keeping them packed)
+			 * @throw ParseError if contents are not valid (they are kept pending)
+			 */
+			void 												Parse() const;
+
+			/**
+			 * Moves the packed items into m_items
+			 */
+			virtual void 										Unpack() {}
+
+			/**
+			 * Gets items holding the packed ones to read them (safe to be called concurrently)
+			 * @return items
+			 */
+			virtual const std::vector<Base::PointerType>& 		PackedItems() const {
+				return *m_items;
+			}
+
+			/**
+			 * Notes that the items are handed out to be replaced (see Items())
+			 */
+			virtual void 										Expose() noexcept {}
+
+			/**
+			 * Notes that an item is handed out to be changed
+			 * @param position item position
+			 */
+			virtual void 										Expose(const std::size_t& position) noexcept {}
+
+			/**
+			 * Gets the number of packed items
 			 * @return size_t number of items
 			 */
-			size_t 												Count() const noexcept;
+			virtual std::size_t 								PackedSize() const noexcept {
+				return 0;
+			}
 
-		protected:
-			std::vector<Base::PointerType> 						m_items;	///< Items in container
+			/**
+			 * Internal function to get item contents as string
+			 * @return item contents as std::string
+			 */
+			virtual std::string 								ContentsToString(const int& level) const noexcept;
 
 			/**
-			 * Actions to be done before adding an item
-			 * @param item item to check
+			 * Gets an item to change it, copying it first if it is shared
+			 * @param position item position
+			 * @return item
+			 */
+			Base& 												Own(const std::size_t& position);
+
+			/**
+			 * Finds an item by name (without parsing deferred contents)
+			 * @param name item name
+			 * @return iterator to item or end if not found
+			 */
+			std::vector<Base::PointerType>::const_iterator		Find(std::string_view name) const noexcept;
+
+			/**
+			 * Finds an item by interned name (without parsing deferred contents)
+			 *
+			 * Names are compared by address, so unnamed items (like comments) are rejected
+			 * without asking their type.
+			 * @param symbol interned item name
+			 * @return iterator to item or end if not found
+			 */
+			virtual std::vector<Base::PointerType>::const_iterator	Find(const SymbolTable::Symbol& symbol) const noexcept;
+
+			/**
+			 * Updates what is kept about the items after some of them were removed
+			 */
+			virtual void 										Reindex() noexcept {}
+
+			/**
+			 * Checks an item and adds it unless the existing one is kept
+			 * @param item item to add (moved from when added)
 			 * @param onexisting action to take if item name already exists
 			 * @throw ItemNameAlreadyExists if item name already exists
+			 * @return added or kept item
 			 */
-			virtual Base::PointerType							BeforeAdditionActions(Base::PointerType item, const OnExistingAction onexisting) = 0;
+			virtual Base&										BeforeAdditionActions(Base::PointerType&& item, const OnExistingAction onexisting) = 0;
 
 		private:
+			friend class Parser::Builder;
+			friend class Parser::Parser;
+			friend class Resolver;
+
 			/**
-			 * Internal function to get item contents as string
-			 * @return item contents as std::string
+			 * @struct HashCache
+			 * @brief Structural hash kept until the container changes an item or hands one out (taken by readers, so it is atomic)
 			 */
-			virtual std::string 								ContentsToString(const int& level) const noexcept;
+			struct HashCache {
+				std::atomic<SymbolTable::Symbol> name = nullptr;	///< Container name the hash was taken with (null if it was not)
+				std::atomic<std::size_t> hash = 0;				///< Structural hash
+
+				HashCache() noexcept							= default;
+
+				/**
+				 * Copy constructor (copies have the same items)
+				 * @param cache cache to copy
+				 */
+				HashCache(const HashCache& cache) noexcept {
+					operator=(cache);
+				}
+
+				/**
+				 * Assignment operator
+				 * @param cache cache to copy
+				 * @return this
+				 */
+				HashCache& operator=(const HashCache& cache) noexcept {
+					hash.store(cache.hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					name.store(cache.name.load(std::memory_order_acquire), std::memory_order_release);
+					return *this;
+				}
+			};
+
+			mutable std::shared_ptr<const Parser::Deferred>		m_deferred;	///< Contents to parse on first access (if any)
+			bool 												m_references = false;	///< Were string values resolving references added below? (pending contents included)
+			mutable HashCache 									m_hash;		///< Structural hash compared before the items
+
+			/**
+			 * Gets the structural hash (see Item::Hash), taking it only if it was forgotten or the container renamed
+			 * @throw ParseError if contents waiting to be parsed are not valid
+			 * @return structural hash
+			 */
+			std::size_t 										CachedHash() const;
+
+			/**
+			 * Forgets the structural hash (the items are changed or handed out to be changed)
+			 */
+			inline void 										ForgetHash() noexcept {
+				m_hash.name.store(nullptr, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Adds an item without handing it out to be changed (as the parser does)
+			 * @param item item to add
+			 * @param on_existing action to take if item already exists
+			 * @throw ItemNameAlreadyExists if item name already exists
+			 * @return reference to added item
+			 */
+			Base& 												Insert(Base::PointerType item, const OnExistingAction& on_existing);
+
+			/**
+			 * Checks if an item is a string value resolving references or a container with some
+			 * @param item item to check
+			 * @return bool resolves references?
+			 */
+			static bool 										Resolves(const Base& item) noexcept;
 
 			/**
 			 * Internal function for checking if path name is valid
@@ -291,17 +493,25 @@ namespace StormByte::Config::Item {
 			 * Looks up a child by path
 			 * @param path path to child
 			 * @throw ItemNotFound if not found
-			 * @return const reference to found Item
+			 * @return found Item
 			 */
-			const Base& 										LookUp(const std::string& path) const;
+			const Base::PointerType& 							LookUp(const std::string& path) const;
 
 			/**
 			 * Looks up a child by path
 			 * @param path path to child
 			 * @throw ItemNotFound if not found
-			 * @return const reference to found Item
+			 * @return found Item
+			 */
+			const Base::PointerType& 							LookUp(std::queue<std::string>& path) const;
+
+			/**
+			 * Looks up a child by path to change it (copying it and its parents if shared)
+			 * @param path path to child
+			 * @throw ItemNotFound if not found
+			 * @return found Item
 			 */
-			const Base& 										LookUp(std::queue<std::string>& path) const;
+			Base& 												Modify(std::queue<std::string>& path);
 
 			/**
 			 * Removes an item by path
@@ -1,18 +1,32 @@
 #include <StormByte/config/item/group.hxx>
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 
 using namespace StormByte::Config::Item;
 
+namespace {
+	/**
+	 * Hashes an interned name (Fibonacci hashing of its address)
+	 * @param symbol interned name
+	 * @return hash
+	 */
+	std::size_t Hash(const SymbolTable::Symbol& symbol) noexcept {
+		return static_cast<std::size_t>((static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(symbol)) * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+}
+
 Group::Group(const std::string& name):Container(name) {}
 
 Group::Group(std::string&& name):Container(std::move(name)) {}
 
-Base::PointerType Group::BeforeAdditionActions(Base::PointerType item, const OnExistingAction onexisting) {
+Base& Group::BeforeAdditionActions(Base::PointerType&& item, const OnExistingAction onexisting) {
 	if (!item) {
 		throw Exception("Tried to add a null pointer to Group!");
 	}
 
+	bool removed = false;
 	if (item->Type() != Type::Comment) {
 		if (!item->Name().has_value())
 			throw InvalidName();
@@ -20,18 +34,21 @@ Base::PointerType Group::BeforeAdditionActions(Base::PointerType item, const OnE
 			throw InvalidName(item->Name().value(), ContainerType());
 		}
 
-		// Don't use Exists here for better speed
-		const auto it = std::find_if(m_items.begin(), m_items.end(), [&item](const Base::PointerType& i) {
-			return i->Type() != Type::Comment && i->Name().value() == item->Name().value();
-		});
-		if (it != m_items.end()) {
+		// Don't use Exists here for better speed (and index renamed items rather than looking for them)
+		Refresh();
+		const auto it = Find(item->Symbol());
+		if (it != m_items->end()) {
+			const std::size_t position = it - m_items->begin();
 			switch (onexisting) {
 				case OnExistingAction::Keep:
-					return *it;
+					return Own(position);
 					break;
-				case OnExistingAction::Overwrite:
-					m_items.erase(it);
+				case OnExistingAction::Overwrite: {
+					auto& items = m_items.Edit();
+					items.erase(items.begin() + position);
+					removed = true;
 					break;
+				}
 				case OnExistingAction::ThrowException:
 					throw ItemNameAlreadyExists(*item->Name());
 					break;
@@ -39,6 +56,127 @@ Base::PointerType Group::BeforeAdditionActions(Base::PointerType item, const OnE
 		}
 	}
 
-	m_items.push_back(item);
-	return m_items.back();
+	auto& items = m_items.Edit();
+	items.push_back(std::move(item));
+	// Positions after the removed item changed
+	if (removed)
+		Reindex();
+	else
+		IndexLast();
+	return *items.back();
+}
+
+std::vector<Base::PointerType>::const_iterator Group::Find(const SymbolTable::Symbol& symbol) const noexcept {
+	const auto& index = *m_index;
+	if (index.empty())
+		return Container::Find(symbol);
+
+	const auto& items = *m_items;
+	const std::size_t mask = index.size() - 1;
+	for (std::size_t slot = Hash(symbol) & mask; index[slot].symbol; slot = (slot + 1) & mask) {
+		if (index[slot].symbol == symbol) {
+			const std::size_t position = index[slot].position;
+			if (position < items.size() && items[position]->Symbol() == symbol)
+				return items.begin() + position;
+			// Renamed since indexed
+			break;
+		}
+	}
+
+	// Items handed out since indexed could have been renamed to it
+	if (m_replaced)
+		return Container::Find(symbol);
+	for (const std::size_t position: m_exposed) {
+		if (position < items.size() && items[position]->Symbol() == symbol)
+			return items.begin() + position;
+	}
+	return items.end();
+}
+
+void Group::Reindex() noexcept {
+	m_exposed.clear();
+	m_outdated = 0;
+	m_replaced = false;
+	m_index.Reset();
+	const auto& items = *m_items;
+	if (items.size() < c_index_threshold)
+		return;
+
+	try {
+		// Room for the items to double before growing, at half load at most
+		auto& index = m_index.Edit();
+		index.assign(std::bit_ceil(items.size() * 4), Slot { nullptr, 0 });
+		for (std::size_t position = 0; position < items.size(); position++) {
+			if (items[position]->Name())
+				Place(index, items, items[position]->Symbol(), position);
+		}
+	}
+	catch (...) {
+		// Items are still found by scanning them
+		m_index.Reset();
+	}
+}
+
+void Group::Refresh() noexcept {
+	if (m_exposed.empty() && !m_replaced)
+		return;
+	const auto& items = *m_items;
+	if (m_replaced || m_index.IsShared() || (items.size() + m_outdated + m_exposed.size()) * 2 > m_index->size()) {
+		Reindex();
+		return;
+	}
+
+	// Entries of their former names are left behind, they are checked against the item names anyway
+	auto& index = m_index.Edit();
+	for (const std::size_t position: m_exposed) {
+		if (position < items.size() && items[position]->Name())
+			Place(index, items, items[position]->Symbol(), position);
+	}
+	m_outdated += m_exposed.size();
+	m_exposed.clear();
+}
+
+void Group::Expose() noexcept {
+	if (!m_index->empty())
+		m_replaced = true;
+}
+
+void Group::Expose(const std::size_t& position) noexcept {
+	// Small groups are not indexed, and building the index again is cheaper once most items were handed out
+	if (m_index->empty() || m_replaced)
+		return;
+	if (m_exposed.size() * 2 >= m_items->size())
+		m_replaced = true;
+	else {
+		try {
+			m_exposed.push_back(position);
+		}
+		catch (...) {
+			m_replaced = true;
+		}
+	}
+}
+
+void Group::IndexLast() noexcept {
+	const auto& items = *m_items;
+	// An index shared with a copy is built again rather than copied
+	if (m_index->empty() ? items.size() >= c_index_threshold : (items.size() + m_outdated) * 2 > m_index->size() || m_index.IsShared())
+		Reindex();
+	else if (!m_index->empty() && items.back()->Name())
+		Place(m_index.Edit(), items, items.back()->Symbol(), items.size() - 1);
+}
+
+void Group::Place(std::vector<Slot>& index, const std::vector<Base::PointerType>& items, const SymbolTable::Symbol& symbol, const std::size_t& position) noexcept {
+	const std::size_t mask = index.size() - 1;
+	std::size_t slot = Hash(symbol) & mask;
+	for (; index[slot].symbol; slot = (slot + 1) & mask) {
+		if (index[slot].symbol == symbol) {
+			// First one wins (the group is only expected to have one) unless it was renamed since
+			const std::size_t indexed = index[slot].position;
+			if (indexed < items.size() && items[indexed]->Symbol() == symbol)
+				return;
+			break;
+		}
+	}
+	index[slot] = { symbol, position };
 }
@@ -16,6 +16,12 @@ namespace StormByte::Config::Item {
 	 * 		credit = 66.5
 	 * }
 	 * @endcode
+	 *
+	 * Groups with many items keep an open addressing index from name to position, so adding
+	 * and finding items by name does not scan them. Items handed out to be changed (by index,
+	 * path, Items() or as returned by Add) are also looked for by their current names, and
+	 * indexed again on the next addition, so rename items taken again from the group rather
+	 * than through older references.
 	 */
 	class STORMBYTE_CONFIG_PUBLIC Group: public Container {
 		public:
@@ -91,11 +97,70 @@ namespace StormByte::Config::Item {
 
 		private:
 			/**
-			 * Actions to be done before adding an item
-			 * @param item item to check
+			 * @struct Slot
+			 * @brief Index entry
+			 */
+			struct Slot {
+				SymbolTable::Symbol symbol;						///< Item name (null for an empty slot)
+				std::size_t position;							///< Item position
+			};
+
+			static constexpr std::size_t c_index_threshold = 16;	///< Number of items from which the index is kept
+
+			Shared<std::vector<Slot>> m_index;					///< Index by name, linearly probed (empty for small groups, shared by copies until changed)
+			std::vector<std::size_t> m_exposed;					///< Positions of the items handed out to be changed (maybe renamed) since indexed
+			std::size_t m_outdated = 0;							///< Index entries left behind by items indexed again
+			bool m_replaced = false;							///< Could items have been replaced since the index was built?
+
+			/**
+			 * Finds an item by interned name through the index
+			 * @param symbol interned item name
+			 * @return iterator to item or end if not found
+			 */
+			std::vector<Base::PointerType>::const_iterator		Find(const SymbolTable::Symbol& symbol) const noexcept override;
+
+			/**
+			 * Builds the index again (or drops it for small groups)
+			 */
+			void 												Reindex() noexcept override;
+
+			/**
+			 * Indexes again the items handed out to be changed (or builds the index again)
+			 */
+			void 												Refresh() noexcept;
+
+			/**
+			 * Notes that the items are handed out to be replaced
+			 */
+			void 												Expose() noexcept override;
+
+			/**
+			 * Notes that an item is handed out to be changed (and maybe renamed)
+			 * @param position item position
+			 */
+			void 												Expose(const std::size_t& position) noexcept override;
+
+			/**
+			 * Indexes the last added item
+			 */
+			void 												IndexLast() noexcept;
+
+			/**
+			 * Puts an item in the index (which must have a free slot)
+			 * @param index index
+			 * @param items items (to replace the entry of an item renamed since)
+			 * @param symbol item name
+			 * @param position item position
+			 */
+			static void 										Place(std::vector<Slot>& index, const std::vector<Base::PointerType>& items, const SymbolTable::Symbol& symbol, const std::size_t& position) noexcept;
+
+			/**
+			 * Checks an item and adds it unless the existing one is kept
+			 * @param item item to add (moved from when added)
 			 * @param onexisting action to take if item name already exists
 			 * @throw ItemNameAlreadyExists if item name already exists
+			 * @return added or kept item
 			 */
-			Base::PointerType									BeforeAdditionActions(Base::PointerType item, const OnExistingAction onexisting) override;
+			Base&												BeforeAdditionActions(Base::PointerType&& item, const OnExistingAction onexisting) override;
 	};
 }
\ No newline at end of file
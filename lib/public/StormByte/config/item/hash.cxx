@@ -0,0 +1,122 @@
+#include <StormByte/config/item/hash.hxx>
+#include <StormByte/config/item/list.hxx>
+#include <StormByte/config/item/visit.hxx>
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+using namespace StormByte::Config::Item;
+
+namespace {
+	/**
+	 * Mixes a value into a hash
+	 * @param seed hash so far
+	 * @param value value to mix
+	 * @return hash
+	 */
+	constexpr std::size_t Combine(const std::size_t& seed, const std::size_t& value) noexcept {
+		return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+	}
+
+	/**
+	 * Gets a container as a packed list
+	 * @param container container
+	 * @return list (null if it is not a packed list)
+	 */
+	const List* Packed(const Container& container) {
+		if (container.ContainerType() != ContainerType::List || !static_cast<const List&>(container).IsPacked())
+			return nullptr;
+		return &static_cast<const List&>(container);
+	}
+
+	/**
+	 * Calls a function with each child of a container (packed values as the items they unpack to, without unpacking them)
+	 * @param container container
+	 * @param function function to call with each child
+	 */
+	template<class Function>
+	void ForEachChild(const Container& container, Function&& function) {
+		if (const List* list = Packed(container)) {
+			std::visit([&function](const auto& values) {
+				using Values = std::remove_cvref_t<decltype(values)>;
+				if constexpr (!std::is_same_v<Values, std::monostate>) {
+					for (const auto value: values)
+						function(Value<typename Values::value_type>(value));
+				}
+			}, list->Packed());
+		}
+		else {
+			for (const auto& child: container.Items())
+				function(*child);
+		}
+	}
+}
+
+namespace StormByte::Config::Item {
+	std::size_t Hash(const Base& item) {
+		std::size_t hash = Combine(static_cast<std::size_t>(item.Type()), std::hash<const void*>()(item.Symbol()));
+		return Visit(item, [hash](const auto& value) {
+			using Kind = std::remove_cvref_t<decltype(value)>;
+			if constexpr (std::is_same_v<Kind, Container>) {
+				std::size_t children = Combine(hash, static_cast<std::size_t>(value.ContainerType()));
+				ForEachChild(value, [&children](const Base& child) {
+					children = Combine(children, Hash(child));
+				});
+				return children;
+			}
+			else if constexpr (std::is_same_v<Kind, Base>)
+				// Comments
+				return Combine(hash, std::hash<std::string_view>()(static_cast<const Value<std::string>&>(value).View()));
+			else if constexpr (std::is_same_v<Kind, Value<std::string>>)
+				return Combine(hash, std::hash<std::string_view>()(value.View()));
+			else
+				return Combine(hash, std::hash<std::remove_cvref_t<decltype(*value)>>()(*value));
+		});
+	}
+
+	bool Equal(const Base& a, const Base& b) {
+		if (&a == &b)
+			return true;
+		if (a.Type() != b.Type() || a != b)
+			return false;
+		return Visit(a, [&b](const auto& value) {
+			using Kind = std::remove_cvref_t<decltype(value)>;
+			if constexpr (std::is_same_v<Kind, Container>) {
+				const Container& other = static_cast<const Container&>(b);
+				if (value.ContainerType() != other.ContainerType() || value.Size() != other.Size())
+					return false;
+				const List* packed = Packed(value);
+				const List* other_packed = Packed(other);
+				if (packed && other_packed)
+					return packed->Packed() == other_packed->Packed();
+				if (packed || other_packed) {
+					const auto items = (packed ? other : value).Items();
+					std::size_t index = 0;
+					bool equal = true;
+					ForEachChild(packed ? value : other, [&items, &index, &equal](const Base& child) {
+						equal = equal && Equal(child, *items[index++]);
+					});
+					return equal;
+				}
+				const auto items = value.Items();
+				const auto other_items = other.Items();
+				if (items.size() != other_items.size())
+					return false;
+				for (std::size_t index = 0; index < items.size(); index++) {
+					if (!Equal(*items[index], *other_items[index]))
+						return false;
+				}
+				return true;
+			}
+			else if constexpr (std::is_same_v<Kind, Base>)
+				// Comments of different kinds are only told apart by how they are written
+				return value.Serialize(0) == b.Serialize(0);
+			else if constexpr (std::is_same_v<Kind, Value<std::string>>)
+				return value.View() == static_cast<const Kind&>(b).View();
+			else
+				return *value == *static_cast<const Kind&>(b);
+		});
+	}
+}
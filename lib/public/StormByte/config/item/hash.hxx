@@ -0,0 +1,31 @@
+#pragma once
+
+#include <StormByte/config/item/base.hxx>
+
+#include <cstddef>
+
+/**
+ * @namespace Item
+ * @brief All the configuration item classes namespace
+ */
+namespace StormByte::Config::Item {
+	/**
+	 * Gets the structural hash of an item (its type, name, value and children)
+	 *
+	 * String values are hashed as written (without resolving references). Containers
+	 * waiting to be parsed are parsed.
+	 * @param item item to hash
+	 * @throw ParseError if a container waiting to be parsed is not valid
+	 * @return hash
+	 */
+	STORMBYTE_CONFIG_PUBLIC std::size_t 							Hash(const Base& item);
+
+	/**
+	 * Checks if two items are structurally equal (same type, name, value and children)
+	 * @param a item to compare
+	 * @param b item to compare
+	 * @throw ParseError if a container waiting to be parsed is not valid
+	 * @return are equal?
+	 */
+	STORMBYTE_CONFIG_PUBLIC bool 									Equal(const Base& a, const Base& b);
+}
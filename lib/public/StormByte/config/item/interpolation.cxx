@@ -0,0 +1,176 @@
+#include <StormByte/config/item/container.hxx>
+#include <StormByte/config/item/interpolation.hxx>
+#include <StormByte/config/item/value.hxx>
+#include <StormByte/config/item/visit.hxx>
+
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+using namespace StormByte::Config::Item;
+
+namespace {
+	thread_local std::vector<const void*> t_resolving;			///< Values being resolved by this thread (reached again means a cycle)
+
+	/**
+	 * Gets the text a referenced item is replaced with
+	 * @param item referenced item
+	 * @param path reference path
+	 * @return text
+	 */
+	std::string Render(const Base& item, const std::string& path) {
+		return Visit(item, [&path](const auto& value) -> std::string {
+			using Kind = std::remove_cvref_t<decltype(value)>;
+			if constexpr (std::is_same_v<Kind, Value<std::string>>)
+				return value.Resolved();
+			else if constexpr (std::is_same_v<Kind, Value<int>>)
+				return std::to_string(*value);
+			else if constexpr (std::is_same_v<Kind, Value<double>>) {
+				char buffer[32];
+				const auto res = std::to_chars(buffer, buffer + sizeof(buffer), *value);
+				return std::string(buffer, res.ptr);
+			}
+			else if constexpr (std::is_same_v<Kind, Value<bool>>)
+				return *value ? "true" : "false";
+			else
+				throw StormByte::Config::Exception("Reference ${" + path + "} is not a value");
+		});
+	}
+}
+
+struct Interpolation::State {
+	/**
+	 * @struct Dependency
+	 * @brief Referenced item along with the text it was replaced with
+	 */
+	struct Dependency {
+		std::weak_ptr<const Base> item;							///< Referenced item (expired when removed)
+		std::string path;										///< Reference path
+		std::string text;										///< Text it was replaced with
+	};
+
+	/**
+	 * @struct Result
+	 * @brief Resolved value along with what it was built from (never changed once built)
+	 */
+	struct Result {
+		std::string raw;										///< Value it was resolved from
+		std::string resolved;									///< Resolved value
+		std::vector<Dependency> dependencies;					///< Items it was built from
+	};
+
+	std::shared_ptr<const Resolver> resolver;					///< Resolver of the tree
+	std::mutex mutex;											///< Guards result
+	std::shared_ptr<const Result> result;						///< Memoized result (null until resolved)
+};
+
+Resolver::Resolver(const Container* root) noexcept:m_root(root) {}
+
+void Resolver::Root(const Container* root) noexcept {
+	m_root = root;
+}
+
+std::shared_ptr<const Base> Resolver::Find(const std::string& path) const {
+	if (!m_root)
+		throw Exception("Reference ${" + path + "} can not be resolved as its configuration no longer exists");
+	return m_root->LookUp(path);
+}
+
+Interpolation::Interpolation() noexcept = default;
+
+Interpolation::Interpolation(const Interpolation& interpolation) {
+	if (interpolation.m_state)
+		Attach(interpolation.m_state->resolver);
+}
+
+Interpolation::Interpolation(Interpolation&& interpolation) noexcept = default;
+
+Interpolation& Interpolation::operator=(const Interpolation& interpolation) {
+	if (this != &interpolation) {
+		m_state.reset();
+		if (interpolation.m_state)
+			Attach(interpolation.m_state->resolver);
+	}
+	return *this;
+}
+
+Interpolation& Interpolation::operator=(Interpolation&& interpolation) noexcept = default;
+
+Interpolation::~Interpolation() noexcept = default;
+
+void Interpolation::Attach(std::shared_ptr<const Resolver> resolver) {
+	if (!resolver) {
+		m_state.reset();
+		return;
+	}
+	m_state = std::make_unique<State>();
+	m_state->resolver = std::move(resolver);
+}
+
+const Resolver* Interpolation::Attached() const noexcept {
+	return m_state ? m_state->resolver.get() : nullptr;
+}
+
+void Interpolation::Forget() noexcept {
+	if (m_state) {
+		std::lock_guard lock(m_state->mutex);
+		m_state->result.reset();
+	}
+}
+
+std::string Interpolation::ResolveReferences(std::string_view raw) const {
+	State& state = *m_state;
+	if (std::find(t_resolving.begin(), t_resolving.end(), &state) != t_resolving.end())
+		throw Exception("Reference cycle detected while resolving \"" + std::string(raw) + "\"");
+	t_resolving.push_back(&state);
+	struct Guard {
+		~Guard() { t_resolving.pop_back(); }
+	} guard;
+
+	std::shared_ptr<const State::Result> result;
+	{
+		std::lock_guard lock(state.mutex);
+		result = state.result;
+	}
+	// Referenced items are looked up again as they could have been replaced (or copied on write)
+	if (result && result->raw == raw && std::all_of(result->dependencies.begin(), result->dependencies.end(), [&state](const State::Dependency& dependency) {
+		const auto item = state.resolver->Find(dependency.path);
+		return item == dependency.item.lock() && Render(*item, dependency.path) == dependency.text;
+	}))
+		return result->resolved;
+
+	auto built = std::make_shared<State::Result>();
+	built->raw = raw;
+	std::size_t position = 0;
+	while (position < raw.size()) {
+		const std::size_t start = raw.find('$', position);
+		if (start == std::string_view::npos)
+			break;
+		built->resolved.append(raw, position, start - position);
+		if (raw.compare(start, 3, "$${") == 0) {
+			built->resolved += "${";
+			position = start + 3;
+		}
+		else if (raw.compare(start, 2, "${") == 0 && raw.find('}', start + 2) != std::string_view::npos) {
+			const std::size_t end = raw.find('}', start + 2);
+			std::string path(raw.substr(start + 2, end - start - 2));
+			const auto item = state.resolver->Find(path);
+			std::string text = Render(*item, path);
+			built->resolved += text;
+			built->dependencies.push_back({ item, std::move(path), std::move(text) });
+			position = end + 1;
+		}
+		else {
+			built->resolved += '$';
+			position = start + 1;
+		}
+	}
+	if (position < raw.size())
+		built->resolved.append(raw, position);
+
+	std::lock_guard lock(state.mutex);
+	state.result = built;
+	return built->resolved;
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <StormByte/config/exception.hxx>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Item
+ * @brief All the configuration item classes namespace
+ */
+namespace StormByte::Config::Item {
+	// Forwards
+	class Base;
+	class Container;
+
+	/**
+	 * @class Resolver
+	 * @brief Finds the items referenced by string values of a configuration tree
+	 *
+	 * It is shared by the string values of the tree so the root can be moved (or
+	 * destroyed) without leaving them pointing to it.
+	 */
+	class STORMBYTE_CONFIG_PUBLIC Resolver {
+		public:
+			/**
+			 * Constructor
+			 * @param root root container paths are resolved from
+			 */
+			explicit Resolver(const Container* root) noexcept;
+
+			/**
+			 * Copy constructor
+			 */
+			Resolver(const Resolver&)							= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Resolver(Resolver&&)								= delete;
+
+			/**
+			 * Assignment operator
+			 */
+			Resolver& operator=(const Resolver&)				= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Resolver& operator=(Resolver&&)						= delete;
+
+			/**
+			 * Destructor
+			 */
+			~Resolver() noexcept								= default;
+
+			/**
+			 * Sets the root container
+			 * @param root root container (null when it no longer exists)
+			 */
+			void 												Root(const Container* root) noexcept;
+
+			/**
+			 * Finds an item by path
+			 * @param path path from root
+			 * @throw ItemNotFound if item is not found
+			 * @throw Exception if root no longer exists
+			 * @return item
+			 */
+			std::shared_ptr<const Base> 						Find(const std::string& path) const;
+
+		private:
+			const Container* m_root;							///< Root container
+	};
+
+	/**
+	 * @class Interpolation
+	 * @brief Memoized resolution of the ${path} references of a string value
+	 *
+	 * References are resolved on first read and the result is kept along with the
+	 * items it was built from, so later reads only look those items up again and check
+	 * they were not replaced nor changed, without building the string again. Strings being
+	 * resolved by the reading thread which are reached again are a cycle, so they are
+	 * found without looking at the rest of the tree. Use $${ for a literal ${.
+	 *
+	 * The result is replaced as a whole under a lock, so it can be read concurrently
+	 * (as long as the tree is not changed meanwhile).
+	 */
+	class STORMBYTE_CONFIG_PUBLIC Interpolation {
+		public:
+			/**
+			 * Constructor (references are not resolved until attached)
+			 */
+			Interpolation() noexcept;
+
+			/**
+			 * Copy constructor (the resolved value is not copied)
+			 * @param interpolation interpolation to copy
+			 */
+			Interpolation(const Interpolation& interpolation);
+
+			/**
+			 * Move constructor
+			 * @param interpolation interpolation to move
+			 */
+			Interpolation(Interpolation&& interpolation) noexcept;
+
+			/**
+			 * Assignment operator (the resolved value is not copied)
+			 * @param interpolation interpolation to copy
+			 */
+			Interpolation& operator=(const Interpolation& interpolation);
+
+			/**
+			 * Move assignment operator
+			 * @param interpolation interpolation to move
+			 */
+			Interpolation& operator=(Interpolation&& interpolation) noexcept;
+
+			/**
+			 * Destructor
+			 */
+			~Interpolation() noexcept;
+
+			/**
+			 * Resolves references from now on
+			 * @param resolver resolver of the tree the value belongs to (null to stop resolving them)
+			 */
+			void 												Attach(std::shared_ptr<const Resolver> resolver);
+
+			/**
+			 * Gets the resolver references are resolved with
+			 * @return resolver (null when not attached)
+			 */
+			const Resolver* 									Attached() const noexcept;
+
+			/**
+			 * Drops the resolved value (as the raw one is about to change)
+			 */
+			void 												Forget() noexcept;
+
+			/**
+			 * Gets a value with its references resolved
+			 * @param raw value as written
+			 * @throw ItemNotFound if a referenced item is not found
+			 * @throw Exception if a reference is not a value or is part of a cycle
+			 * @return resolved value (raw itself when not attached)
+			 */
+			inline std::string 									Resolve(std::string_view raw) const {
+				return m_state ? ResolveReferences(raw) : std::string(raw);
+			}
+
+		private:
+			struct State;
+			std::unique_ptr<State> m_state;						///< Resolver and memoized result (null when not attached)
+
+			/**
+			 * Resolves references reusing the last result when still valid
+			 * @param raw value as written
+			 * @return resolved value
+			 */
+			std::string 										ResolveReferences(std::string_view raw) const;
+	};
+}
@@ -1,37 +1,97 @@
+#include <StormByte/config/item/hash.hxx>
 #include <StormByte/config/item/list.hxx>
+#include <StormByte/config/item/value.hxx>
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
 
 using namespace StormByte::Config::Item;
 
+namespace {
+	constexpr std::size_t c_empty = static_cast<std::size_t>(-1);
+
+	/**
+	 * Spreads a structural hash over the index (Fibonacci hashing)
+	 * @param hash structural hash
+	 * @return spread hash
+	 */
+	std::size_t Spread(const std::size_t& hash) noexcept {
+		return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+
+	/**
+	 * Checks if packed values have duplicates
+	 * @param values packed values
+	 * @return has duplicates?
+	 */
+	template<typename T>
+	bool HasDuplicates(const std::vector<T>& values) {
+		if constexpr (std::is_same_v<T, bool>)
+			return values.size() > 2 || (values.size() == 2 && values[0] == values[1]);
+		else {
+			// Positions of the values by hash, linearly probed, so no value is allocated on its own
+			std::vector<std::size_t> slots(std::bit_ceil(values.size() * 2), c_empty);
+			const std::size_t mask = slots.size() - 1;
+			for (std::size_t position = 0; position < values.size(); position++) {
+				std::size_t slot = Spread(std::hash<T>()(values[position])) & mask;
+				for (; slots[slot] != c_empty; slot = (slot + 1) & mask) {
+					if (values[slots[slot]] == values[position])
+						return true;
+				}
+				slots[slot] = position;
+			}
+			return false;
+		}
+	}
+
+	/**
+	 * Collects the values of items
+	 * @param items items (all of them Value<T>)
+	 * @return values
+	 */
+	template<typename T>
+	std::vector<T> Collect(const std::vector<Base::PointerType>& items) {
+		std::vector<T> values;
+		values.reserve(items.size());
+		for (const auto& item: items)
+			values.push_back(*static_cast<const Value<T>&>(*item));
+		return values;
+	}
+}
+
 List::List(const std::string& name):Container(name) {}
 
 List::List(std::string&& name):Container(std::move(name)) {}
 
-Base::PointerType List::BeforeAdditionActions(Base::PointerType item, const OnExistingAction on_existing) {
+Base& List::BeforeAdditionActions(Base::PointerType&& item, const OnExistingAction on_existing) {
 	if (!item) {
 		throw Exception("Tried to add a null pointer to List!");
 	}
 	
-	if (item->Type() != Type::Comment) {
-		if (item->Name().has_value()) {
-			throw InvalidName(item->Name().value(), ContainerType());
-		}	
-
-		auto item_iterator = std::find_if(
-			m_items.begin(),
-			m_items.end(),
-			[&item](std::shared_ptr<Base>& i) {
-				return (*i == *item) == 0;
-			}
-		);
-		if (item_iterator != m_items.end()) {
+	if (item->Type() != Type::Comment && item->Name().has_value()) {
+		throw InvalidName(item->Name().value(), ContainerType());
+	}
+
+	const bool checked = m_mode == ListMode::Unique && IsChecked(*item);
+	std::size_t hash = 0;
+	bool removed = false;
+	if (checked) {
+		Refresh();
+		hash = Hash(*item);
+		const auto it = FindEqual(*item, hash);
+		if (it != m_items->end()) {
+			const std::size_t position = it - m_items->begin();
 			switch (on_existing) {
 				case OnExistingAction::Keep:
-					return *item_iterator;
+					return Own(position);
 					break;
 				case OnExistingAction::Overwrite: {
-					m_items.erase(item_iterator);
+					auto& items = m_items.Edit();
+					items.erase(items.begin() + position);
+					removed = true;
 					break;
 				}
 				case OnExistingAction::ThrowException:
@@ -41,6 +101,234 @@ Base::PointerType List::BeforeAdditionActions(Base::PointerType item, const OnEx
 		}
 	}
 
-	m_items.push_back(item);
-	return m_items.back();
-}
\ No newline at end of file
+	auto& items = m_items.Edit();
+	items.push_back(std::move(item));
+	// Positions after the removed item changed (and an index shared with a copy is built again rather than copied)
+	if (removed)
+		Reindex();
+	else if (checked) {
+		if (m_index->empty() ? items.size() >= c_index_threshold : (items.size() + m_outdated) * 2 > m_index->size() || m_index.IsShared())
+			Reindex();
+		else if (!m_index->empty())
+			Place(m_index.Edit(), hash, items.size() - 1);
+	}
+	return *items.back();
+}
+
+std::vector<Base::PointerType>::const_iterator List::FindEqual(const Base& item, const std::size_t& hash) const {
+	const auto& items = *m_items;
+	const auto& index = *m_index;
+	if (index.empty()) {
+		return std::find_if(items.begin(), items.end(), [&item](const Base::PointerType& existing) {
+			return IsChecked(*existing) && Equal(*existing, item);
+		});
+	}
+
+	const std::size_t mask = index.size() - 1;
+	for (std::size_t slot = Spread(hash) & mask; index[slot].position != c_empty; slot = (slot + 1) & mask) {
+		const std::size_t position = index[slot].position;
+		// Items replaced through Items() are compared by what they are now
+		if (index[slot].hash == hash && position < items.size() && IsChecked(*items[position]) && Equal(*items[position], item))
+			return items.begin() + position;
+	}
+	return items.end();
+}
+
+const std::vector<bool>& List::Bits() const {
+	const auto* values = std::get_if<std::vector<bool>>(&Packed());
+	if (!values)
+		throw WrongValueTypeConversion(ContainerTypeToString(), std::string("packed ") + Item::TypeToString(Item::Type::Bool));
+	return *values;
+}
+
+bool List::Pack() {
+	Parse();
+	if (m_packed)
+		return true;
+	const auto& items = *m_items;
+	if (items.empty())
+		return false;
+
+	const Item::Type type = items.front()->Type();
+	if (type != Type::Integer && type != Type::Double && type != Type::Bool)
+		return false;
+	for (const auto& item: items) {
+		if (item->Type() != type)
+			return false;
+	}
+
+	switch(type) {
+		case Type::Integer:
+			m_values.Edit() = Collect<int>(items);
+			break;
+		case Type::Double:
+			m_values.Edit() = Collect<double>(items);
+			break;
+		default:
+			m_values.Edit() = Collect<bool>(items);
+			break;
+	}
+	m_packed = true;
+	m_items.Reset();
+	Reindex();
+	return true;
+}
+
+bool List::IsSealable() const {
+	return PackedSize() >= c_pack_threshold && std::visit([this](const auto& values) {
+		using Values = std::remove_cvref_t<decltype(values)>;
+		if constexpr (std::is_same_v<Values, std::monostate>)
+			return false;
+		else
+			return m_mode == ListMode::Append || !HasDuplicates(values);
+	}, *m_values);
+}
+
+List::PackedValues List::Release() {
+	// Values shared with a copy are copied, otherwise moved
+	PackedValues values = m_values.IsShared() ? *m_values : std::move(m_values.Edit());
+	m_values.Reset();
+	m_view.items.store(nullptr, std::memory_order_relaxed);
+	m_packed = false;
+	return values;
+}
+
+void List::Unpack() {
+	// Values were checked when packed, and items already made for readers are taken (copied once changed)
+	m_items.Edit() = PackedItems();
+	m_packed = false;
+	Reindex();
+}
+
+const std::vector<Base::PointerType>& List::PackedItems() const {
+	auto view = m_view.items.load(std::memory_order_acquire);
+	if (!view) {
+		auto items = std::make_shared<std::vector<Base::PointerType>>();
+		std::visit([&items](const auto& values) {
+			using Values = std::remove_cvref_t<decltype(values)>;
+			if constexpr (!std::is_same_v<Values, std::monostate>) {
+				items->reserve(values.size());
+				for (const auto value: values)
+					items->push_back(MakePointer<Item::Value<typename Values::value_type>>(value));
+			}
+		}, *m_values);
+
+		// Readers making them at once keep the first ones
+		std::shared_ptr<const std::vector<Base::PointerType>> made = std::move(items);
+		if (m_view.items.compare_exchange_strong(view, made, std::memory_order_acq_rel, std::memory_order_acquire))
+			view = std::move(made);
+	}
+	// Kept alive by the view until the list changes
+	return *view;
+}
+
+std::size_t List::PackedSize() const noexcept {
+	return std::visit([](const auto& values) -> std::size_t {
+		if constexpr (std::is_same_v<std::remove_cvref_t<decltype(values)>, std::monostate>)
+			return 0;
+		else
+			return values.size();
+	}, *m_values);
+}
+
+std::string List::ContentsToString(const int& indent_level) const noexcept {
+	if (!m_packed)
+		return Container::ContentsToString(indent_level);
+
+	std::string serial = "";
+	std::visit([&serial, &indent_level](const auto& values) {
+		using Values = std::remove_cvref_t<decltype(values)>;
+		if constexpr (!std::is_same_v<Values, std::monostate>) {
+			for (const auto value: values)
+				serial += Item::Value<typename Values::value_type>(value).Serialize(indent_level) + "\n";
+		}
+	}, *m_values);
+	return serial;
+}
+
+void List::Reindex() noexcept {
+	// Packed values are dropped once the list is cleared or unpacked
+	if (!m_packed)
+		m_values.Reset();
+	m_view.items.store(nullptr, std::memory_order_release);
+	m_exposed.clear();
+	m_outdated = 0;
+	m_replaced = false;
+	m_index.Reset();
+	const auto& items = *m_items;
+	if (m_mode == ListMode::Append || items.size() < c_index_threshold)
+		return;
+
+	try {
+		// Room for the items to double before growing, at half load at most
+		auto& index = m_index.Edit();
+		index.assign(std::bit_ceil(items.size() * 4), Slot { 0, c_empty });
+		for (std::size_t position = 0; position < items.size(); position++) {
+			if (IsChecked(*items[position]))
+				Place(index, Hash(*items[position]), position);
+		}
+	}
+	catch (...) {
+		// Items are still found by comparing them all
+		m_index.Reset();
+	}
+}
+
+void List::Refresh() {
+	if (m_exposed.empty() && !m_replaced)
+		return;
+	const auto& items = *m_items;
+	if (m_replaced || m_index.IsShared() || (items.size() + m_outdated + m_exposed.size()) * 2 > m_index->size()) {
+		Reindex();
+		return;
+	}
+
+	// Entries with their former hashes are left behind, they are compared with what the items are now anyway
+	auto& index = m_index.Edit();
+	const std::size_t mask = index.size() - 1;
+	for (const std::size_t position: m_exposed) {
+		if (position >= items.size() || !IsChecked(*items[position]))
+			continue;
+		const std::size_t hash = Hash(*items[position]);
+		std::size_t slot = Spread(hash) & mask;
+		while (index[slot].position != c_empty && (index[slot].hash != hash || index[slot].position != position))
+			slot = (slot + 1) & mask;
+		if (index[slot].position == c_empty) {
+			index[slot] = { hash, position };
+			m_outdated++;
+		}
+	}
+	m_exposed.clear();
+}
+
+void List::Expose() noexcept {
+	m_replaced = true;
+}
+
+void List::Expose(const std::size_t& position) noexcept {
+	// Small lists are not indexed, and building the index again is cheaper once most items were handed out
+	if (m_index->empty() || m_replaced)
+		return;
+	if (m_exposed.size() * 2 >= m_items->size())
+		m_replaced = true;
+	else {
+		try {
+			m_exposed.push_back(position);
+		}
+		catch (...) {
+			m_replaced = true;
+		}
+	}
+}
+
+void List::Place(std::vector<Slot>& index, const std::size_t& hash, const std::size_t& position) noexcept {
+	const std::size_t mask = index.size() - 1;
+	std::size_t slot = Spread(hash) & mask;
+	while (index[slot].position != c_empty)
+		slot = (slot + 1) & mask;
+	index[slot] = { hash, position };
+}
+
+bool List::IsChecked(const Base& item) noexcept {
+	return item.Type() != Type::Comment;
+}
@@ -2,6 +2,8 @@
 
 #include <StormByte/config/item/container.hxx>
 
+#include <variant>
+
 /**
  * @namespace Item
  * @brief All the configuration item classes namespace
@@ -16,9 +18,27 @@ namespace StormByte::Config::Item {
 	 * 		"/usr/local/include"
 	 * ]
 	 * @endcode
+	 *
+	 * Added items which are structurally equal to an existing one (see Item::Equal) are
+	 * duplicates unless the list appends without checking. Comments are never duplicates,
+	 * and containers waiting to be parsed (see ParseMode::Lazy) are parsed to be checked.
+	 * Lists with many items keep an index by structural hash; items handed out to be
+	 * changed (by index, path, Items() or as returned by Add) are hashed again on the next
+	 * addition, so take them again rather than changing them through older references.
+	 *
+	 * Lists made only of integers, doubles or booleans can be packed (see PackMode): their
+	 * values are kept contiguously (booleans as bits) instead of as items, and read with Span
+	 * or Bits. Non const access to their items (by index, path or Items()) unpacks them once,
+	 * while const access reads items made for the values once (shared by concurrent readers)
+	 * and keeps the list packed.
 	 */
 	class STORMBYTE_CONFIG_PUBLIC List final: public Container {
 		public:
+			/**
+			 * Packed values (empty while the list is not packed)
+			 */
+			using PackedValues = std::variant<std::monostate, std::vector<int>, std::vector<double>, std::vector<bool>>;
+
 			/**
 			 * Constructor
 			 */
@@ -89,13 +109,236 @@ namespace StormByte::Config::Item {
 				return ContainerType::List;
 			}
 
+			/**
+			 * Gets how items are added
+			 * @return list mode
+			 */
+			constexpr ListMode 									Mode() const noexcept {
+				return m_mode;
+			}
+
+			/**
+			 * Sets how items are added
+			 * @param mode list mode
+			 */
+			inline void 										Mode(const ListMode& mode) noexcept {
+				m_mode = mode;
+				Reindex();
+			}
+
+			/**
+			 * Checks if the values are packed
+			 * @return bool packed?
+			 */
+			inline bool 										IsPacked() const {
+				Parse();
+				return m_packed;
+			}
+
+			/**
+			 * Gets the packed values
+			 * @return packed values (monostate if not packed)
+			 */
+			inline const PackedValues& 							Packed() const {
+				Parse();
+				return *m_values;
+			}
+
+			/**
+			 * Gets the packed values as a contiguous span, without unpacking them
+			 * @tparam T value type (int or double)
+			 * @throw WrongValueTypeConversion if the list is not packed with values of this type
+			 * @return std::span of values
+			 */
+			template<typename T> requires std::is_same_v<T, int> || std::is_same_v<T, double>
+			std::span<const T> 									Span() const {
+				const auto* values = std::get_if<std::vector<T>>(&Packed());
+				if (!values)
+					throw WrongValueTypeConversion(ContainerTypeToString(), std::string("packed ") + Item::TypeToString(Item::TypeOf<T>()));
+				return std::span(*values);
+			}
+
+			/**
+			 * Gets the packed booleans (one bit each), without unpacking them
+			 * @throw WrongValueTypeConversion if the list is not packed with booleans
+			 * @return packed booleans
+			 */
+			const std::vector<bool>& 							Bits() const;
+
+			/**
+			 * Packs the values if they are all integers, doubles or booleans
+			 *
+			 * References to the items are not valid anymore once packed.
+			 * @throw ParseError if contents waiting to be parsed are not valid
+			 * @return bool packed?
+			 */
+			bool 												Pack();
+
 		private:
+			friend class Parser::Builder;
+
+			/**
+			 * @struct Slot
+			 * @brief Index entry
+			 */
+			struct Slot {
+				std::size_t hash;								///< Item structural hash
+				std::size_t position;							///< Item position (npos for an empty slot)
+			};
+
+			static constexpr std::size_t c_index_threshold = 16;	///< Number of items from which the index is kept
+			static constexpr std::size_t c_pack_threshold = 16;	///< Number of values from which parsed lists are kept packed
+
+			ListMode m_mode = ListMode::Unique;					///< How items are added
+			Shared<std::vector<Slot>> m_index;					///< Index by structural hash, linearly probed (empty for small lists, shared by copies until changed)
+			Shared<PackedValues> m_values;						///< Packed values (used while m_packed is set, shared by copies until changed)
+			std::vector<std::size_t> m_exposed;					///< Positions of the items handed out to be changed since indexed
+			std::size_t m_outdated = 0;							///< Index entries left behind by items indexed again
+			bool m_replaced = false;							///< Could items have been replaced since the index was built?
+
+			/**
+			 * @struct PackedView
+			 * @brief Items made for the packed values to read them (made by readers, so it is atomic)
+			 */
+			struct PackedView {
+				std::atomic<std::shared_ptr<const std::vector<Base::PointerType>>> items;	///< Items (null until read)
+
+				PackedView() noexcept							= default;
+
+				/**
+				 * Copy constructor (copies share the packed values)
+				 * @param view view to copy
+				 */
+				PackedView(const PackedView& view) noexcept {
+					operator=(view);
+				}
+
+				/**
+				 * Assignment operator
+				 * @param view view to copy
+				 * @return this
+				 */
+				PackedView& operator=(const PackedView& view) noexcept {
+					items.store(view.items.load(std::memory_order_acquire), std::memory_order_release);
+					return *this;
+				}
+			};
+
+			mutable PackedView m_view;							///< Items made for the packed values (dropped with them)
+
 			/**
-			 * Actions to be done before adding an item
+			 * Appends a value to the packed ones while building the list
+			 *
+			 * Values are not checked for duplicates until the list is sealed, and nothing reads
+			 * them meanwhile (so no items were made for them).
+			 * @param value value to append
+			 * @return bool appended? (not if the list has other items or values of another type)
+			 */
+			template<typename T>
+			bool 												Append(const T& value) {
+				if (!m_packed) {
+					if (!m_items->empty())
+						return false;
+					m_values.Edit().template emplace<std::vector<T>>();
+					m_packed = true;
+				}
+				auto* values = std::get_if<std::vector<T>>(&m_values.Edit());
+				if (!values)
+					return false;
+				values->push_back(value);
+				return true;
+			}
+
+			/**
+			 * Checks if the values appended while building are worth keeping packed
+			 *
+			 * They are not when there are few of them, or when some are duplicated and the list
+			 * is unique (so they are added as items and the existing action is taken).
+			 * @return bool keep them packed?
+			 */
+			bool 												IsSealable() const;
+
+			/**
+			 * Takes the packed values (the list is not packed anymore)
+			 * @return packed values
+			 */
+			PackedValues 										Release();
+
+			/**
+			 * Moves the packed values into items
+			 */
+			void 												Unpack() override;
+
+			/**
+			 * Gets items holding the packed values, making them on first use
+			 * @return items
+			 */
+			const std::vector<Base::PointerType>& 				PackedItems() const override;
+
+			/**
+			 * Gets the number of packed values
+			 * @return size_t number of values
+			 */
+			std::size_t 										PackedSize() const noexcept override;
+
+			/**
+			 * Writes the items (packed values are written as their items would be)
+			 * @return items as std::string
+			 */
+			std::string 										ContentsToString(const int& level) const noexcept override;
+
+			/**
+			 * Finds an item structurally equal to another
+			 * @param item item to find
+			 * @param hash item structural hash
+			 * @return iterator to item or end if not found
+			 */
+			std::vector<Base::PointerType>::const_iterator		FindEqual(const Base& item, const std::size_t& hash) const;
+
+			/**
+			 * Builds the index again (or drops it for small or appending lists)
+			 */
+			void 												Reindex() noexcept override;
+
+			/**
+			 * Indexes again the items handed out to be changed (or builds the index again)
+			 * @throw ParseError if an item has contents waiting to be parsed which are not valid
+			 */
+			void 												Refresh();
+
+			/**
+			 * Notes that the items are handed out to be replaced
+			 */
+			void 												Expose() noexcept override;
+
+			/**
+			 * Notes that an item is handed out to be changed
+			 * @param position item position
+			 */
+			void 												Expose(const std::size_t& position) noexcept override;
+
+			/**
+			 * Puts an item in the index (which must have a free slot)
+			 * @param index index
+			 * @param hash item structural hash
+			 * @param position item position
+			 */
+			static void 										Place(std::vector<Slot>& index, const std::size_t& hash, const std::size_t& position) noexcept;
+
+			/**
+			 * Checks if an item takes part in duplicate checks
 			 * @param item item to check
-			 * @param onexisting action to take if item name already exists
-			 * @throw ItemNameAlreadyExists if item name already exists
+			 * @return is checked?
+			 */
+			static bool 										IsChecked(const Base& item) noexcept;
+
+			/**
+			 * Checks an item and adds it unless the existing one is kept
+			 * @param item item to add (moved from when added)
+			 * @param onexisting action to take if an equal item already exists
+			 * @throw ItemAlreadyExists if an equal item already exists
+			 * @return added or kept item
 			 */
-			Base::PointerType									BeforeAdditionActions(Base::PointerType item, const OnExistingAction onexisting) override;
+			Base&												BeforeAdditionActions(Base::PointerType&& item, const OnExistingAction onexisting) override;
 	};
 }
\ No newline at end of file
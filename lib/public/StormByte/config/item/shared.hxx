@@ -0,0 +1,111 @@
+#pragma once
+
+#include <memory>
+
+/**
+ * @namespace Item
+ * @brief All the configuration item classes namespace
+ */
+namespace StormByte::Config::Item {
+	/**
+	 * @class Shared
+	 * @brief Value shared by its copies until one of them changes it (copy on write)
+	 *
+	 * Copying is a reference count increment; the value is only copied when changed
+	 * while shared. Like the items holding it, it is not safe to change concurrently
+	 * with reading its copies.
+	 * @tparam T value type
+	 */
+	template<class T>
+	class Shared {
+		public:
+			/**
+			 * Constructor (empty value, which takes no memory until changed)
+			 */
+			Shared() noexcept										= default;
+
+			/**
+			 * Copy constructor
+			 * @param shared value to share
+			 */
+			Shared(const Shared& shared) noexcept					= default;
+
+			/**
+			 * Move constructor
+			 * @param shared value to move
+			 */
+			Shared(Shared&& shared) noexcept						= default;
+
+			/**
+			 * Assignment operator
+			 * @param shared value to share
+			 */
+			Shared& operator=(const Shared& shared) noexcept		= default;
+
+			/**
+			 * Move assignment operator
+			 * @param shared value to move
+			 */
+			Shared& operator=(Shared&& shared) noexcept				= default;
+
+			/**
+			 * Destructor
+			 */
+			~Shared() noexcept										= default;
+
+			/**
+			 * Gets the value to read it
+			 * @return value
+			 */
+			inline const T& 										operator*() const noexcept {
+				return m_value ? *m_value : Empty();
+			}
+
+			/**
+			 * Gets the value to read it
+			 * @return value
+			 */
+			inline const T* 										operator->() const noexcept {
+				return &operator*();
+			}
+
+			/**
+			 * Gets the value to change it, copying it first if it is shared
+			 * @return value
+			 */
+			T& 														Edit() {
+				if (!m_value)
+					m_value = std::make_shared<T>();
+				else if (m_value.use_count() > 1)
+					m_value = std::make_shared<T>(*m_value);
+				return *m_value;
+			}
+
+			/**
+			 * Checks if the value is shared with a copy
+			 * @return bool shared?
+			 */
+			inline bool 											IsShared() const noexcept {
+				return m_value.use_count() > 1;
+			}
+
+			/**
+			 * Empties the value (copies keep theirs)
+			 */
+			inline void 											Reset() noexcept {
+				m_value.reset();
+			}
+
+		private:
+			std::shared_ptr<T> m_value;								///< Value (null while empty)
+
+			/**
+			 * Gets the empty value
+			 * @return empty value
+			 */
+			static const T& 										Empty() noexcept {
+				static const T empty {};
+				return empty;
+			}
+	};
+}
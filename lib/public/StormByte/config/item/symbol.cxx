@@ -0,0 +1,83 @@
+#include <StormByte/config/item/symbol.hxx>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+using namespace StormByte::Config::Item;
+
+namespace {
+	/**
+	 * @struct Shard
+	 * @brief Part of the table (names are spread by hash so threads seldom wait for each other)
+	 */
+	struct Shard {
+		std::shared_mutex mutex;														///< Mutex for the names
+		std::unordered_map<std::string_view, std::unique_ptr<const std::optional<std::string>>> names;	///< Names by text (keys view their own value)
+	};
+
+	/**
+	 * Gets every shard
+	 * @return shards
+	 */
+	std::array<Shard, 16>& Shards() noexcept {
+		// Never destroyed so items in static storage can still be named while exiting
+		static auto& shards = *new std::array<Shard, 16>;
+		return shards;
+	}
+
+	/**
+	 * Gets the shard a name belongs to
+	 * @param name name
+	 * @return shard
+	 */
+	Shard& ShardOf(std::string_view name) noexcept {
+		auto& shards = Shards();
+		return shards[std::hash<std::string_view>()(name) % shards.size()];
+	}
+
+	/**
+	 * Finds a name in a shard (mutex must be held)
+	 * @param shard shard
+	 * @param name name
+	 * @return symbol (null if not found)
+	 */
+	SymbolTable::Symbol FindLocked(const Shard& shard, std::string_view name) noexcept {
+		const auto it = shard.names.find(name);
+		return it == shard.names.end() ? nullptr : it->second.get();
+	}
+}
+
+SymbolTable::Symbol SymbolTable::Intern(std::string_view name) {
+	Shard& shard = ShardOf(name);
+	{
+		std::shared_lock<std::shared_mutex> lock(shard.mutex);
+		if (const Symbol symbol = FindLocked(shard, name))
+			return symbol;
+	}
+	std::unique_lock<std::shared_mutex> lock(shard.mutex);
+	if (const Symbol symbol = FindLocked(shard, name))
+		return symbol;
+	auto symbol = std::make_unique<const std::optional<std::string>>(std::string(name));
+	const Symbol interned = symbol.get();
+	shard.names.emplace(std::string_view(**interned), std::move(symbol));
+	return interned;
+}
+
+SymbolTable::Symbol SymbolTable::Find(std::string_view name) noexcept {
+	Shard& shard = ShardOf(name);
+	std::shared_lock<std::shared_mutex> lock(shard.mutex);
+	return FindLocked(shard, name);
+}
+
+std::size_t SymbolTable::Size() noexcept {
+	std::size_t size = 0;
+	for (auto& shard: Shards()) {
+		std::shared_lock<std::shared_mutex> lock(shard.mutex);
+		size += shard.names.size();
+	}
+	return size;
+}
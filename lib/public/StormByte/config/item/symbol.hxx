@@ -0,0 +1,55 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Item
+ * @brief All the configuration item classes namespace
+ */
+namespace StormByte::Config::Item {
+	/**
+	 * @class SymbolTable
+	 * @brief Process wide table of interned item names
+	 *
+	 * Every distinct name is stored once and items point to it, so names with the same
+	 * text have the same address and are compared by it. Interning is safe from several
+	 * threads. Names are never released (configurations tend to reuse a small set of them).
+	 */
+	class STORMBYTE_CONFIG_PUBLIC SymbolTable {
+		public:
+			/**
+			 * Interned name (points to the unnamed symbol for unnamed items, never null)
+			 */
+			using Symbol = const std::optional<std::string>*;
+
+			/**
+			 * Symbol of unnamed items
+			 */
+			static inline const std::optional<std::string> c_unnamed {};
+
+			/**
+			 * Gets the symbol for a name, adding it if needed
+			 * @param name name to intern
+			 * @return symbol
+			 */
+			static Symbol 											Intern(std::string_view name);
+
+			/**
+			 * Gets the symbol for a name without adding it
+			 * @param name name to find
+			 * @return symbol (null if no item was ever named so)
+			 */
+			static Symbol 											Find(std::string_view name) noexcept;
+
+			/**
+			 * Gets the number of interned names
+			 * @return size_t number of names
+			 */
+			static std::size_t 										Size() noexcept;
+	};
+}
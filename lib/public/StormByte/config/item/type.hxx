@@ -107,4 +107,21 @@ namespace StormByte::Config::Item {
                           std::is_same_v<T, double> || 
                           std::is_same_v<T, bool> || 
                           std::is_same_v<T, std::string>;
+
+	/**
+	 * Gets the item type of a value type
+	 * @tparam T value type
+	 * @return item type
+	 */
+	template<AllowedValueType T>
+	constexpr Type TypeOf() noexcept {
+		if constexpr (std::is_same_v<T, std::string>)
+			return Type::String;
+		else if constexpr (std::is_same_v<T, int>)
+			return Type::Integer;
+		else if constexpr (std::is_same_v<T, double>)
+			return Type::Double;
+		else
+			return Type::Bool;
+	}
 }
\ No newline at end of file
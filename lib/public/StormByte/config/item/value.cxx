@@ -5,7 +5,7 @@
 namespace StormByte::Config::Item {
 	template<>
 	std::string Value<std::string>::Serialize(const int& indent_level) const noexcept {
-		return Base::Serialize(indent_level) + "\"" + m_value + "\"";
+		return Base::Serialize(indent_level) + "\"" + std::string(View()) + "\"";
 	}
 	template class Value<std::string>;
 
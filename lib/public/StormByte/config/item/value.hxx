@@ -1,6 +1,19 @@
 #pragma once
 
 #include <StormByte/config/item/base.hxx>
+#include <StormByte/config/item/interpolation.hxx>
+
+#include <string_view>
+#include <variant>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	// Forwards
+	class Builder;
+}
 
 /**
  * @namespace Item
@@ -10,6 +23,9 @@ namespace StormByte::Config::Item {
 	/**
 	 * @class Value
 	 * @brief Class for a item value in a configuration file
+	 *
+	 * Parsed strings can view the source they were read from (see StringMode::View) until
+	 * they are accessed as std::string, when they are copied into owned storage.
 	 * @tparam T item type (only std::string, int, double, bool allowed)
 	 */
 	template<AllowedValueType T>
@@ -19,37 +35,37 @@ namespace StormByte::Config::Item {
 			 * Constructor
 			 * @param value item value
 			 */
-			Value(const T& value):Base(), m_value(value) {}
+			Value(const T& value):Base(TypeOf<T>()), m_value(value) {}
 
 
 			template <typename U = T>
 			Value(const char* value) requires std::is_same_v<U, std::string>
-				: Base(), m_value(std::string(value)) {}
+				: Base(TypeOf<T>()), m_value(std::string(value)) {}
 
 			
 			template <typename U = T>
 			Value(const char* name, const char* value) requires std::is_same_v<U, std::string>
-				: Base(std::string(name)), m_value(std::string(value)) {}
+				: Base(TypeOf<T>(), name), m_value(std::string(value)) {}
 
 			/**
 			 * Move Constructor
 			 * @param value item value
 			 */
-			Value(T&& value):Base(), m_value(std::move(value)) {}
+			Value(T&& value):Base(TypeOf<T>()), m_value(std::move(value)) {}
 
 			/**
 			 * Constructor
 			 * @param name item name
 			 * @param value item value
 			 */
-			Value(const std::string& name, const T& value):Base(name), m_value(value) {}
+			Value(const std::string& name, const T& value):Base(TypeOf<T>(), name), m_value(value) {}
 
 			/**
 			 * Move Constructor
 			 * @param name item name
 			 * @param value item value
 			 */
-			Value(std::string&& name, T&& value):Base(std::move(name)), m_value(std::move(value)) {}
+			Value(std::string&& name, T&& value):Base(TypeOf<T>(), std::move(name)), m_value(std::move(value)) {}
 
 			/**
 			 * Constructor overload (for std::string only)
@@ -57,7 +73,7 @@ namespace StormByte::Config::Item {
 			 * @param value item value
 			 */
 			Value(const std::string& name, const char* value) requires std::is_same_v<T, std::string>
-			: Base(name), m_value(std::string(value)) {}
+			: Base(TypeOf<T>(), name), m_value(std::string(value)) {}
 	
 			/**
 			 * Move Constructor overload (for std::string only)
@@ -65,7 +81,7 @@ namespace StormByte::Config::Item {
 			 * @param value item value
 			 */
 			Value(std::string&& name, const char* value) requires std::is_same_v<T, std::string>
-			: Base(std::move(name)), m_value(std::string(value)) {}
+			: Base(TypeOf<T>(), std::move(name)), m_value(std::string(value)) {}
 
 			/**
 			 * Copy constructor
@@ -96,21 +112,6 @@ namespace StormByte::Config::Item {
 			 */
 			virtual ~Value() noexcept override				= default;
 
-			/**
-			 * Gets the item type
-			 * @return item type
-			 */
-			constexpr virtual Item::Type 					Type() const noexcept override {
-				if constexpr (std::is_same_v<T, std::string>) {
-					return Item::Type::String;
-				} else if constexpr (std::is_same_v<T, int>) {
-					return Item::Type::Integer;
-				} else if constexpr (std::is_same_v<T, double>) {
-					return Item::Type::Double;
-				} else if constexpr (std::is_same_v<T, bool>)
-					return Item::Type::Bool;
-			}
-
 			/**
 			 * Equality operator
 			 * @param single item to compare
@@ -126,7 +127,10 @@ namespace StormByte::Config::Item {
 				}
 			
 				// Compare the m_value
-				return m_value == single.m_value;
+				if constexpr (std::is_same_v<T, std::string>)
+					return View() == single.View();
+				else
+					return m_value == single.m_value;
 			}
 
 			/**
@@ -139,23 +143,71 @@ namespace StormByte::Config::Item {
 			}
 
 			/**
-			 * Gets the item value
+			 * Gets the item value to change it (strings viewing their source are copied first, and their resolved value is dropped)
 			 * @return item value
 			 */
-			T& 												operator*() noexcept {
+			T& 												operator*() noexcept(!std::is_same_v<T, std::string>) {
+				if constexpr (std::is_same_v<T, std::string>) {
+					Own();
+					m_interpolation.Forget();
+				}
 				return m_value;
 			}
 
 			/**
-			 * Gets the item value
+			 * Gets the item value (strings viewing their source are copied first)
 			 * @return item value
 			 */
-			const T& 										operator*() const noexcept {
+			const T& 										operator*() const noexcept(!std::is_same_v<T, std::string>) {
+				if constexpr (std::is_same_v<T, std::string>)
+					Own();
 				return m_value;
 			}
 
 			/**
-			 * Serializes the item
+			 * Gets the value as written without copying it (for std::string only)
+			 * @return view of the value (valid until the item is modified or destroyed)
+			 */
+			std::string_view 								View() const noexcept requires std::is_same_v<T, std::string> {
+				return m_view.data() ? m_view : std::string_view(m_value);
+			}
+
+			/**
+			 * Checks if the value is still a view of the source it was read from (for std::string only)
+			 * @return bool is a view?
+			 */
+			bool 											IsView() const noexcept requires std::is_same_v<T, std::string> {
+				return m_view.data() != nullptr;
+			}
+
+			/**
+			 * Resolves the ${path} references to other items of the tree when read (for std::string only)
+			 * @param resolver resolver of the tree the item belongs to (null to read them as written)
+			 */
+			void 											References(std::shared_ptr<const Resolver> resolver) requires std::is_same_v<T, std::string> {
+				m_interpolation.Attach(std::move(resolver));
+			}
+
+			/**
+			 * Gets the resolver the ${path} references are resolved with (for std::string only)
+			 * @return resolver (null when they are read as written)
+			 */
+			const Resolver* 								References() const noexcept requires std::is_same_v<T, std::string> {
+				return m_interpolation.Attached();
+			}
+
+			/**
+			 * Gets the item value with its references resolved (for std::string only)
+			 * @throw ItemNotFound if a referenced item is not found
+			 * @throw Exception if a reference is not a value or is part of a cycle
+			 * @return resolved value
+			 */
+			std::string 									Resolved() const requires std::is_same_v<T, std::string> {
+				return m_interpolation.Resolve(View());
+			}
+
+			/**
+			 * Serializes the item (strings are written with their references unresolved)
 			 * @param indent_level intentation level
 			 * @return serialized string
 			 */
@@ -179,6 +231,33 @@ namespace StormByte::Config::Item {
 
 		protected:
 			T m_value;										///< Item value
+			[[no_unique_address]] std::conditional_t<std::is_same_v<T, std::string>, Interpolation, std::monostate> m_interpolation;	///< References resolution (strings only)
+			[[no_unique_address]] std::conditional_t<std::is_same_v<T, std::string>, std::string_view, std::monostate> m_view;	///< Source text the value is read from until owned (strings only)
+
+		private:
+			friend class Parser::Builder;
+
+			/**
+			 * Makes the value a view of source text, which must outlive the item (for std::string only)
+			 * @param text text to view
+			 */
+			void 											Borrow(std::string_view text) noexcept requires std::is_same_v<T, std::string> {
+				m_value.clear();
+				m_view = text;
+			}
+
+			/**
+			 * Copies the viewed text into the value (for std::string only)
+			 *
+			 * Values viewing their source are not safe to be read concurrently until this is done.
+			 */
+			void 											Own() const requires std::is_same_v<T, std::string> {
+				if (!m_view.data())
+					return;
+				auto& self = const_cast<Value&>(*this);
+				self.m_value.assign(m_view);
+				self.m_view = {};
+			}
 	};
 
 	// Deduction guides
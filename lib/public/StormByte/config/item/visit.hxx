@@ -0,0 +1,40 @@
+#pragma once
+
+#include <StormByte/config/item/container.hxx>
+#include <StormByte/config/item/value.hxx>
+
+#include <utility>
+
+/**
+ * @namespace Item
+ * @brief All the configuration item classes namespace
+ */
+namespace StormByte::Config::Item {
+	/**
+	 * Calls a visitor with an item as its concrete type
+	 *
+	 * The type is taken from the item tag, so no virtual function is called. Values are
+	 * passed as Value<T> (with T int, double, bool or std::string), containers as Container
+	 * and comments as Base, as their kind is only known to their own class.
+	 * @param item item to visit
+	 * @param visitor callable accepting every item kind (a generic lambda, for example)
+	 * @return what the visitor returns
+	 */
+	template<class Visitor>
+	decltype(auto) 												Visit(const Base& item, Visitor&& visitor) {
+		switch(item.Type()) {
+			case Type::Integer:
+				return std::forward<Visitor>(visitor)(static_cast<const Value<int>&>(item));
+			case Type::Double:
+				return std::forward<Visitor>(visitor)(static_cast<const Value<double>&>(item));
+			case Type::Bool:
+				return std::forward<Visitor>(visitor)(static_cast<const Value<bool>&>(item));
+			case Type::String:
+				return std::forward<Visitor>(visitor)(static_cast<const Value<std::string>&>(item));
+			case Type::Container:
+				return std::forward<Visitor>(visitor)(static_cast<const Container&>(item));
+			default:
+				return std::forward<Visitor>(visitor)(item);
+		}
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <StormByte/config/visibility.h>
+
+#include <cstddef>
+#include <filesystem>
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @struct Location
+	 * @brief Where an item was read from
+	 */
+	struct STORMBYTE_CONFIG_PUBLIC Location {
+		std::filesystem::path file;									///< File path (empty when not read from a file)
+		unsigned int line;											///< Line number (starting at 1)
+		unsigned int column;										///< Column in bytes (starting at 1)
+		std::size_t offset;											///< Offset from the start of the input
+	};
+}
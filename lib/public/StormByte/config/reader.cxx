@@ -0,0 +1,271 @@
+#include <StormByte/config/item/base.hxx>
+#include <StormByte/config/item/container.hxx>
+#include <StormByte/config/parser/lexer.hxx>
+#include <StormByte/config/parser/parser.hxx>
+#include <StormByte/config/reader.hxx>
+
+using namespace StormByte::Config;
+
+namespace {
+	Reader::Token MakeToken(const Reader::TokenType& type, const Parser::Lexer& lexer) noexcept {
+		return {
+			type,
+			std::string_view(),
+			Item::Type::Container,
+			Item::ContainerType::Group,
+			Item::CommentType::SingleLineBash,
+			std::string_view(),
+			lexer.Position(),
+			&lexer
+		};
+	}
+}
+
+unsigned int Reader::Token::Line() const noexcept {
+	return lexer->Line(offset);
+}
+
+int Reader::Token::AsInteger() const {
+	auto res = Parser::Parser::ParseValue<int>(*this);
+	if (!res)
+		throw *res.error();
+	return res.value();
+}
+
+double Reader::Token::AsDouble() const {
+	auto res = Parser::Parser::ParseValue<double>(*this);
+	if (!res)
+		throw *res.error();
+	return res.value();
+}
+
+bool Reader::Token::AsBool() const {
+	auto res = Parser::Parser::ParseValue<bool>(*this);
+	if (!res)
+		throw *res.error();
+	return res.value();
+}
+
+std::string Reader::Token::AsString() const {
+	std::string value;
+	Parser::Parser::Unescape(raw, value);
+	return value;
+}
+
+Reader::Reader(std::string_view buffer):
+m_lexer(std::make_unique<Parser::Lexer>(buffer)), m_state(State::ContainerStart) {}
+
+Reader::Reader(std::string_view body, const Item::ContainerType& type, const unsigned int& line):
+m_lexer(std::make_unique<Parser::Lexer>(body, line)), m_open { type }, m_state(State::ContainerStart) {}
+
+Reader::Reader(Reader&&) noexcept 				= default;
+
+Reader& Reader::operator=(Reader&&) noexcept 	= default;
+
+Reader::~Reader() noexcept 						= default;
+
+Reader::Token Reader::Next() {
+	auto res = Read();
+	if (!res)
+		throw *res.error();
+	return res.value();
+}
+
+void Reader::SkipValue() {
+	auto res = Skip();
+	if (!res)
+		throw *res.error();
+}
+
+StormByte::Expected<Reader::Token, ParseError> Reader::Read() {
+	if (m_state == State::Finished)
+		return MakeToken(TokenType::EoF, *m_lexer);
+
+	Token token = MakeToken(TokenType::Comment, *m_lexer);
+	auto comment = ReadComment(token);
+	if (!comment)
+		return Unexpected(std::move(comment.error()));
+	if (comment.value())
+		return token;
+
+	if (m_state == State::AfterItem) {
+		const Item::ContainerType current = m_open.empty() ? Item::ContainerType::Group : m_open.back();
+		if (m_lexer->FindContainerEnd(Item::Container::EndCharacter(current))) {
+			// If it is encountered on level 0 it is a syntax error
+			if (m_open.empty())
+				return Unexpected<ParseError>(m_lexer->Line(), "Unexpected container end symbol");
+			m_open.pop_back();
+			token = MakeToken(TokenType::End, *m_lexer);
+			token.container = current;
+			return token;
+		}
+	}
+
+	if (m_lexer->EoF()) {
+		if (!m_open.empty())
+			return Unexpected<ParseError>(m_lexer->Line(), "Unexpected EOF");
+		m_state = State::Finished;
+		return MakeToken(TokenType::EoF, *m_lexer);
+	}
+
+	return ReadItem();
+}
+
+StormByte::Expected<void, ParseError> Reader::Skip() {
+	if (m_open.empty())
+		return Unexpected<ParseError>(m_lexer->Line(), "There is no container to skip");
+
+	if (!m_lexer->SkipContainer(Item::Container::EndCharacter(m_open.back())))
+		return Unexpected<ParseError>(m_lexer->Line(), m_lexer->EoF() ? "Unexpected EOF" : "Unexpected container end symbol");
+
+	m_open.pop_back();
+	m_state = State::AfterItem;
+	return {};
+}
+
+StormByte::Expected<bool, ParseError> Reader::ReadComment(Token& token) {
+	switch (m_lexer->FindComment()) {
+		case Parser::CommentType::SingleLineBash:
+			token.comment = Item::CommentType::SingleLineBash;
+			token.raw = m_lexer->GetLine();
+			break;
+		case Parser::CommentType::SingleLineC:
+			token.comment = Item::CommentType::SingleLineC;
+			token.raw = m_lexer->GetLine();
+			break;
+		case Parser::CommentType::MultiLineC:
+			token.comment = Item::CommentType::MultiLineC;
+			if (!m_lexer->GetUntil("*/", token.raw))
+				return Unexpected<ParseError>(m_lexer->Line(), "Unclosed MultiLineC comment");
+			break;
+		default:
+			return false;
+	}
+	token.kind = Item::Type::Comment;
+	return true;
+}
+
+StormByte::Expected<Reader::Token, ParseError> Reader::ReadItem() {
+	m_lexer->ConsumeWS();
+	if (m_lexer->Peek() == '@')
+		return ReadDirective();
+
+	Token token = MakeToken(TokenType::Value, *m_lexer);
+
+	// Only group items are named
+	if (m_open.empty() || m_open.back() == Item::ContainerType::Group) {
+		token.name = m_lexer->GetStringIgnoringWS();
+		if (!Item::IsNameValid(token.name))
+			return Unexpected<ParseError>(m_lexer->Line(), "Invalid item name: " + std::string(token.name));
+
+		const std::string_view equal = m_lexer->GetStringIgnoringWS();
+		if (equal != "=")
+			return Unexpected<ParseError>(m_lexer->Line(), "Expected '=' after item name " + std::string(token.name) + " but got " + std::string(equal));
+	}
+
+	m_lexer->ConsumeWS();
+	switch (m_lexer->Peek()) {
+		case '"': {
+			auto res = ReadString();
+			if (!res)
+				return Unexpected(std::move(res.error()));
+			token.kind = Item::Type::String;
+			token.raw = res.value();
+			break;
+		}
+		case '[':
+		case '{':
+			token.container = Item::TypeFromStartCharacter(m_lexer->Peek());
+			token.type = token.container == Item::ContainerType::Group ? TokenType::GroupBegin : TokenType::ListBegin;
+			m_lexer->Skip();
+			m_open.push_back(token.container);
+			m_state = State::ContainerStart;
+			return token;
+		case '-':
+		case '+':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			// Possible int or double, we assume int until we find a "." (not exp notation as without a . it is allowed in integers too)
+			token.raw = m_lexer->GetStringIgnoringWS();
+			token.kind = token.raw.find('.', 1) == std::string_view::npos ? Item::Type::Integer : Item::Type::Double;
+			break;
+		case 't':
+		case 'f':
+			token.kind = Item::Type::Bool;
+			token.raw = m_lexer->GetStringIgnoringWS();
+			break;
+		default:
+			return Unexpected<ParseError>(m_lexer->Line(), "Unexpected " + std::string(1, m_lexer->Peek()) + " when parsing item type");
+	}
+
+	m_state = State::AfterItem;
+	return token;
+}
+
+StormByte::Expected<Reader::Token, ParseError> Reader::ReadDirective() {
+	Token token = MakeToken(TokenType::Include, *m_lexer);
+	const std::string_view directive = m_lexer->GetStringIgnoringWS();
+	if (directive != "@include")
+		return Unexpected<ParseError>(m_lexer->Line(), "Unknown directive: " + std::string(directive));
+	// Included items are named so they can only be spliced into groups
+	if (!m_open.empty() && m_open.back() != Item::ContainerType::Group)
+		return Unexpected<ParseError>(m_lexer->Line(), "Include directive is only allowed in groups");
+
+	m_lexer->ConsumeWS();
+	if (m_lexer->Peek() != '"')
+		return Unexpected<ParseError>(m_lexer->Line(), "Expected a quoted path after @include");
+	auto res = ReadString();
+	if (!res)
+		return Unexpected(std::move(res.error()));
+	token.kind = Item::Type::String;
+	token.raw = res.value();
+	m_state = State::AfterItem;
+	return token;
+}
+
+StormByte::Expected<std::string_view, ParseError> Reader::ReadString() {
+	// Item type detection already found the opening " so we skip it
+	m_lexer->Skip();
+	if (m_lexer->EoF())
+		return Unexpected<ParseError>(m_lexer->Line(), "String content was expected but found EOF");
+
+	// Escape sequences are only validated here, they are resolved when the value is converted
+	const std::string_view remaining = m_lexer->Remaining();
+	const std::size_t start = m_lexer->Position();
+	while (true) {
+		m_lexer->GetUntilAnyOf('"', '\\');
+		if (m_lexer->EoF())
+			return Unexpected<ParseError>(m_lexer->Line(), "Expected string closure but got EOF");
+
+		if (m_lexer->Peek() == '"') {
+			const std::string_view raw = remaining.substr(0, m_lexer->Position() - start);
+			m_lexer->Skip();
+			return raw;
+		}
+
+		m_lexer->Skip();
+		if (m_lexer->EoF())
+			return Unexpected<ParseError>(m_lexer->Line(), "Expected string closure but got EOF");
+		const char escaped = m_lexer->Peek();
+		switch (escaped) {
+			case '"':
+			case '\\':
+			case 'n':
+			case 'r':
+			case 't':
+				m_lexer->Skip();
+				break;
+			default:
+				m_lexer->Skip();
+				return Unexpected<ParseError>(m_lexer->Line(), std::string("Invalid escape sequence: \\") + std::string(1, escaped));
+		}
+	}
+}
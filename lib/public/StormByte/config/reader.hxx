@@ -0,0 +1,226 @@
+#pragma once
+
+#include <StormByte/alias.hxx>
+#include <StormByte/config/exception.hxx>
+#include <StormByte/config/item/type.hxx>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace Parser
+ * @brief Parser namespace
+ */
+namespace StormByte::Config::Parser {
+	// Forwards
+	class Lexer;
+	class Parser;
+}
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @class Reader
+	 * @brief Pull cursor over configuration text
+	 *
+	 * Each call to Next() returns the following token without building any item.
+	 * Views returned in tokens point to the input buffer, so they are valid as long
+	 * as the buffer is. Values are not converted until requested, so a malformed
+	 * number is only reported when it is read.
+	 * @code
+	 * Reader reader(buffer);
+	 * for (auto token = reader.Next(); token.type != Reader::TokenType::EoF; token = reader.Next()) {
+	 * 	if (token.type == Reader::TokenType::GroupBegin && token.name != "network")
+	 * 		reader.SkipValue();
+	 * }
+	 * @endcode
+	 */
+	class STORMBYTE_CONFIG_PUBLIC Reader {
+		public:
+			/**
+			 * @enum TokenType
+			 * @brief Token type
+			 */
+			enum class TokenType: unsigned short {
+				GroupBegin,		///< A group starts
+				ListBegin,		///< A list starts
+				End,			///< Current group or list ends
+				Value,			///< A value item
+				Comment,		///< A comment
+				Include,		///< An include directive (raw has the path)
+				EoF				///< End of input
+			};
+
+			/**
+			 * @struct Token
+			 * @brief Token read by the cursor
+			 */
+			struct STORMBYTE_CONFIG_PUBLIC Token {
+				TokenType type;						///< Token type
+				std::string_view name;				///< Item name (empty for unnamed items, ends and comments)
+				Item::Type kind;					///< Value kind (Container for begin/end tokens and Comment for comments)
+				Item::ContainerType container;		///< Container type (only for begin/end tokens)
+				Item::CommentType comment;			///< Comment type (only for comments)
+				std::string_view raw;				///< Raw value text (strings and include paths without quotes and with escapes unresolved, comments without delimiters)
+				std::size_t offset;					///< Offset from the start of the input where the token was found
+				const Parser::Lexer* lexer;			///< Lexer which found the token (to count its line when asked for)
+
+				/**
+				 * Gets the line where the token was found (line breaks are only counted when asked for)
+				 *
+				 * The reader which returned the token has to be alive.
+				 * @return line number
+				 */
+				unsigned int 										Line() const noexcept;
+
+				/**
+				 * Converts an integer value
+				 * @return value
+				 * @throw ParseError if raw value is not a valid integer
+				 */
+				int 												AsInteger() const;
+
+				/**
+				 * Converts a double value
+				 * @return value
+				 * @throw ParseError if raw value is not a valid double
+				 */
+				double 												AsDouble() const;
+
+				/**
+				 * Converts a bool value
+				 * @return value
+				 * @throw ParseError if raw value is not a valid bool
+				 */
+				bool 												AsBool() const;
+
+				/**
+				 * Converts a string value resolving its escape sequences
+				 * @return value
+				 */
+				std::string 										AsString() const;
+			};
+
+			/**
+			 * Constructor
+			 * @param buffer input buffer (it is not copied so it has to outlive the reader)
+			 */
+			Reader(std::string_view buffer);
+
+			/**
+			 * Copy constructor
+			 */
+			Reader(const Reader&) 									= delete;
+
+			/**
+			 * Move constructor
+			 */
+			Reader(Reader&&) noexcept;
+
+			/**
+			 * Assignment operator
+			 */
+			Reader& operator=(const Reader&) 						= delete;
+
+			/**
+			 * Move assignment operator
+			 */
+			Reader& operator=(Reader&&) noexcept;
+
+			/**
+			 * Destructor
+			 */
+			~Reader() noexcept;
+
+			/**
+			 * Reads next token
+			 * @return token (EoF is returned once input is exhausted)
+			 * @throw ParseError if parse errors are found
+			 */
+			Token 													Next();
+
+			/**
+			 * Skips the rest of the current container by bracket matching without parsing it
+			 *
+			 * When called just after a GroupBegin or ListBegin token the whole subtree is skipped.
+			 * No End token is returned for the skipped container.
+			 * @throw ParseError if no container is open or it is not closed
+			 */
+			void 													SkipValue();
+
+			/**
+			 * Gets the number of containers currently open
+			 * @return depth
+			 */
+			inline std::size_t 										Depth() const noexcept {
+				return m_open.size();
+			}
+
+		private:
+			friend class Parser::Parser;
+
+			/**
+			 * @enum State
+			 * @brief Position in the grammar
+			 */
+			enum class State: unsigned short {
+				ContainerStart,		///< Just after container start
+				AfterItem,			///< Just after an item (or a container end)
+				Finished			///< EoF was returned
+			};
+
+			std::unique_ptr<Parser::Lexer> m_lexer;					///< Lexer over the input buffer
+			std::vector<Item::ContainerType> m_open;				///< Open containers (innermost last)
+			State m_state;											///< Current state
+
+			/**
+			 * Constructor for the contents of a single container
+			 * @param body container contents including its end character
+			 * @param type container type
+			 * @param line line number where the contents start
+			 */
+			Reader(std::string_view body, const Item::ContainerType& type, const unsigned int& line);
+
+			/**
+			 * Reads next token
+			 * @return token or error
+			 */
+			Expected<Token, ParseError> 							Read();
+
+			/**
+			 * Skips the rest of the current container
+			 * @return void or error
+			 */
+			Expected<void, ParseError> 								Skip();
+
+			/**
+			 * Reads a comment if any
+			 * @param token token to fill
+			 * @return bool comment found? or error
+			 */
+			Expected<bool, ParseError> 								ReadComment(Token& token);
+
+			/**
+			 * Reads an item
+			 * @return token or error
+			 */
+			Expected<Token, ParseError> 							ReadItem();
+
+			/**
+			 * Reads a directive (only include is supported)
+			 * @return token or error
+			 */
+			Expected<Token, ParseError> 							ReadDirective();
+
+			/**
+			 * Reads a string value
+			 * @return raw string contents or error
+			 */
+			Expected<std::string_view, ParseError> 					ReadString();
+	};
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+
+/**
+ * @namespace Config
+ * @brief All the classes for handling configuration files and items
+ */
+namespace StormByte::Config {
+	/**
+	 * @class Task
+	 * @brief Lazily started coroutine returning a value
+	 *
+	 * It starts when awaited from another coroutine (which is resumed when it finishes) or
+	 * when Get() is called from regular code, which blocks until it finishes.
+	 * @tparam T returned value type
+	 */
+	template<typename T>
+	class Task {
+		public:
+			/**
+			 * @struct promise_type
+			 * @brief Coroutine promise
+			 */
+			struct promise_type {
+				std::optional<T> value;										///< Returned value
+				std::exception_ptr exception;								///< Exception escaping the coroutine (if any)
+				std::coroutine_handle<> continuation;						///< Coroutine awaiting this one (if any)
+				std::shared_ptr<std::atomic<bool>> finished;				///< Flag for Get() (if called)
+
+				/**
+				 * @struct FinalAwaiter
+				 * @brief Resumes the awaiting coroutine or signals Get() when finished
+				 */
+				struct FinalAwaiter {
+					constexpr bool 											await_ready() const noexcept {
+						return false;
+					}
+
+					std::coroutine_handle<> 								await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+						promise_type& promise = handle.promise();
+						if (promise.continuation)
+							return promise.continuation;
+						if (promise.finished) {
+							// Frame can be destroyed as soon as the flag is set so the flag is kept alive here
+							const auto finished = promise.finished;
+							finished->store(true);
+							finished->notify_all();
+						}
+						return std::noop_coroutine();
+					}
+
+					constexpr void 											await_resume() const noexcept {}
+				};
+
+				Task 														get_return_object() noexcept {
+					return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+				}
+
+				constexpr std::suspend_always 								initial_suspend() const noexcept {
+					return {};
+				}
+
+				constexpr FinalAwaiter 										final_suspend() const noexcept {
+					return {};
+				}
+
+				template<typename U>
+				void 														return_value(U&& result) {
+					value.emplace(std::forward<U>(result));
+				}
+
+				void 														unhandled_exception() noexcept {
+					exception = std::current_exception();
+				}
+			};
+
+			/**
+			 * Copy constructor
+			 */
+			Task(const Task&)												= delete;
+
+			/**
+			 * Move constructor
+			 * @param task task to move
+			 */
+			Task(Task&& task) noexcept:m_handle(std::exchange(task.m_handle, nullptr)) {}
+
+			/**
+			 * Assignment operator
+			 */
+			Task& operator=(const Task&)									= delete;
+
+			/**
+			 * Move assignment operator
+			 * @param task task to move
+			 */
+			Task& operator=(Task&& task) noexcept {
+				if (this != &task) {
+					if (m_handle)
+						m_handle.destroy();
+					m_handle = std::exchange(task.m_handle, nullptr);
+				}
+				return *this;
+			}
+
+			/**
+			 * Destructor (the task must not be running)
+			 */
+			~Task() noexcept {
+				if (m_handle)
+					m_handle.destroy();
+			}
+
+			/**
+			 * Starts the task and waits for it to finish
+			 * @return returned value
+			 * @throw any exception escaping the coroutine
+			 */
+			T 																Get() {
+				const auto finished = std::make_shared<std::atomic<bool>>(false);
+				m_handle.promise().finished = finished;
+				m_handle.resume();
+				finished->wait(false);
+				return Result();
+			}
+
+			/**
+			 * Never ready so the task is started when awaited
+			 * @return false
+			 */
+			constexpr bool 													await_ready() const noexcept {
+				return false;
+			}
+
+			/**
+			 * Starts the task which will resume the awaiting coroutine when it finishes
+			 * @param awaiting awaiting coroutine
+			 * @return task coroutine to run
+			 */
+			std::coroutine_handle<> 										await_suspend(std::coroutine_handle<> awaiting) noexcept {
+				m_handle.promise().continuation = awaiting;
+				return m_handle;
+			}
+
+			/**
+			 * Gets the returned value once finished
+			 * @return returned value
+			 * @throw any exception escaping the coroutine
+			 */
+			T 																await_resume() {
+				return Result();
+			}
+
+		private:
+			std::coroutine_handle<promise_type> m_handle;					///< Coroutine handle
+
+			/**
+			 * Constructor
+			 * @param handle coroutine handle
+			 */
+			explicit Task(std::coroutine_handle<promise_type> handle) noexcept:m_handle(handle) {}
+
+			/**
+			 * Takes the returned value
+			 * @return returned value
+			 * @throw any exception escaping the coroutine
+			 */
+			T 																Result() {
+				promise_type& promise = m_handle.promise();
+				if (promise.exception)
+					std::rethrow_exception(promise.exception);
+				return std::move(*promise.value);
+			}
+	};
+}
@@ -14,4 +14,87 @@ namespace StormByte::Config {
 		Overwrite,		///< Overwrite existing item
 		ThrowException	///< Throw exception
 	};
+
+	/**
+	 * @enum OnCommentAction
+	 * @brief What to do with comments when parsing
+	 */
+	enum class OnCommentAction: unsigned short {
+		Keep,			///< Keep comments as items (so they are written back when serializing)
+		Discard			///< Skip comments without creating any item
+	};
+
+	/**
+	 * @enum ParseMode
+	 * @brief How nested containers are parsed when loading
+	 */
+	enum class ParseMode: unsigned short {
+		Eager,			///< Parse everything when loading
+		Lazy,			///< Only match brackets of nested containers when loading and parse them on first access
+		Parallel		///< Parse everything when loading, splitting big inputs by container to use every core
+	};
+
+	/**
+	 * @enum ListMode
+	 * @brief How items are added to lists
+	 */
+	enum class ListMode: unsigned short {
+		Unique,			///< Check added items against the existing ones (following OnExistingAction)
+		Append			///< Append items without checking for duplicates
+	};
+
+	/**
+	 * @enum AllocationMode
+	 * @brief Where parsed items are allocated
+	 */
+	enum class AllocationMode: unsigned short {
+		Heap,			///< Allocate every item on its own
+		Arena			///< Bump allocate items in an arena owned by the configuration, releasing it at once
+	};
+
+	/**
+	 * @enum StringMode
+	 * @brief How parsed strings are stored
+	 */
+	enum class StringMode: unsigned short {
+		Copy,			///< Copy every string into its item
+		View			///< Keep the source alive and view it from strings without escape sequences until they are accessed as std::string
+	};
+
+	/**
+	 * @enum ReferenceMode
+	 * @brief What ${path} in parsed string values means
+	 */
+	enum class ReferenceMode: unsigned short {
+		Literal,		///< Plain text, read as written
+		Resolve			///< Reference to another item, replaced when read through Item::Base::Resolved
+	};
+
+	/**
+	 * @enum LocationMode
+	 * @brief What is kept about where parsed items were read from
+	 */
+	enum class LocationMode: unsigned short {
+		Discard,		///< Nothing, so the parsed text is not kept for it
+		Keep			///< Item offsets along with the parsed text, to tell their locations when asked
+	};
+
+	/**
+	 * @enum PackMode
+	 * @brief How parsed lists of plain values are stored
+	 */
+	enum class PackMode: unsigned short {
+		Items,			///< One item per value
+		Values			///< Contiguous values for lists worth it, read through Item::List::Span and Item::List::Bits
+	};
+
+	/**
+	 * @enum MergeMode
+	 * @brief How the items of several loaded inputs are added to the loading configuration
+	 */
+	enum class MergeMode: unsigned short {
+		None,			///< Not added, every input keeps its own items
+		Copy,			///< Added sharing them with the results (copied on write)
+		Move			///< Moved out of the results, which are left empty
+	};
 }
\ No newline at end of file
@@ -0,0 +1,299 @@
+#include <StormByte/config/config.hxx>
+#include <StormByte/config/incremental_parser.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+
+using namespace StormByte::Config;
+
+/**
+ * Measures the best time of several runs
+ * @param function function to measure
+ * @return best time in milliseconds
+ */
+double measure(const std::function<void()>& function) {
+	double best = 0;
+	for (int run = 0; run < 3; run++) {
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		best = run == 0 ? elapsed.count() : std::min(best, elapsed.count());
+	}
+	return best;
+}
+
+/**
+ * Builds a config with all its items in a single line which ends with a long string
+ * @param items number of items before the long string
+ * @param value_size size of the long string value
+ * @return config contents
+ */
+std::string single_line_config(const std::size_t& items, const std::size_t& value_size) {
+	std::string config;
+	config.reserve(value_size + items * 16 + 16);
+	for (std::size_t i = 0; i < items; i++)
+		config += "item" + std::to_string(i) + " = " + std::to_string(i) + " ";
+	config += "long_string = \"" + std::string(value_size, 'a') + "\"\n";
+	return config;
+}
+
+// Parsing time should grow linearly with input size even when every item shares the line of a huge string
+int benchmark_long_single_line_strings() {
+	const std::size_t megabyte = 1024 * 1024;
+	const std::string small = single_line_config(64, 2 * megabyte);
+	const std::string big = single_line_config(256, 8 * megabyte);
+
+	const double small_time = measure([&small]() { Config cfg; cfg << small; });
+	const double big_time = measure([&big]() { Config cfg; cfg << big; });
+	std::cout << "benchmark_long_single_line_strings: " << small.size() / megabyte << "MB in " << small_time << "ms, "
+		<< big.size() / megabyte << "MB in " << big_time << "ms" << std::endl;
+
+	// 4 times the input, linear growth is expected so leave room for noise but not for quadratic time
+	const bool linear = big_time < std::max(small_time, 1.0) * 8;
+	ASSERT_EQUAL("benchmark_long_single_line_strings", true, linear);
+	RETURN_TEST("benchmark_long_single_line_strings", 0);
+}
+
+/**
+ * Builds a config with many groups of items
+ * @param groups number of groups
+ * @param items number of items per group
+ * @return config contents
+ */
+std::string grouped_config(const std::size_t& groups, const std::size_t& items) {
+	std::string config;
+	for (std::size_t group = 0; group < groups; group++) {
+		config += "group" + std::to_string(group) + " = {\n";
+		for (std::size_t i = 0; i < items; i++)
+			config += "\titem" + std::to_string(i) + " = \"value " + std::to_string(i) + "\"\n";
+		config += "}\n";
+	}
+	return config;
+}
+
+// Lazy loading only matches brackets so it has to be much cheaper when few groups are accessed
+int benchmark_lazy_loading() {
+	const std::string config = grouped_config(2000, 30);
+
+	int value = 0;
+	const double eager_time = measure([&config, &value]() { Config cfg; cfg << config; value += static_cast<int>(cfg["group1000/item5"].Value<std::string>().size()); });
+	const double lazy_time = measure([&config, &value]() { Config cfg; cfg.ParseMode(ParseMode::Lazy); cfg << config; value += static_cast<int>(cfg["group1000/item5"].Value<std::string>().size()); });
+	std::cout << "benchmark_lazy_loading: eager " << eager_time << "ms, lazy " << lazy_time << "ms" << std::endl;
+
+	ASSERT_EQUAL("benchmark_lazy_loading", true, lazy_time < eager_time / 2);
+	RETURN_TEST("benchmark_lazy_loading", 0);
+}
+
+/**
+ * Builds a config with many lists of small numbers
+ * @param lists number of lists
+ * @param items number of items per list
+ * @return config contents
+ */
+std::string numeric_config(const std::size_t& lists, const std::size_t& items) {
+	std::string config;
+	for (std::size_t list = 0; list < lists; list++) {
+		config += "l" + std::to_string(list) + " = [";
+		for (std::size_t i = 0; i < items; i++)
+			config += " " + std::to_string(i);
+		config += " ]\n";
+	}
+	return config;
+}
+
+// Building (and destroying) a tree of small items in an arena must not be slower than allocating each of them (lists are short so they are not packed)
+int benchmark_arena_allocation() {
+	const std::string config = numeric_config(20000, 10);
+
+	std::size_t count = 0;
+	const double heap_time = measure([&config, &count]() { Config cfg; cfg << config; count += cfg.Count(); });
+	const double arena_time = measure([&config, &count]() { Config cfg; cfg.AllocationMode(AllocationMode::Arena); cfg << config; count += cfg.Count(); });
+	std::cout << "benchmark_arena_allocation: heap " << heap_time << "ms, arena " << arena_time << "ms" << std::endl;
+
+	// Leave room for noise (and for the allocator layers in unoptimized builds)
+	ASSERT_EQUAL("benchmark_arena_allocation", true, arena_time < heap_time * 1.5);
+	RETURN_TEST("benchmark_arena_allocation", 0);
+}
+
+/**
+ * Builds a config with a single group of many keys
+ * @param keys number of keys
+ * @return config contents
+ */
+std::string wide_group_config(const std::size_t& keys) {
+	std::string config = "wide = {\n";
+	for (std::size_t i = 0; i < keys; i++)
+		config += "\tkey" + std::to_string(i) + " = " + std::to_string(i) + "\n";
+	config += "}\n";
+	return config;
+}
+
+// Adding and looking up keys in a group must not scan it, so load time grows linearly with its size
+int benchmark_wide_groups() {
+	const std::string small = wide_group_config(12500);
+	const std::string big = wide_group_config(50000);
+
+	int value = 0;
+	const double small_time = measure([&small, &value]() { Config cfg; cfg << small; value += cfg["wide/key12499"].Value<int>(); });
+	const double big_time = measure([&big, &value]() { Config cfg; cfg << big; value += cfg["wide/key49999"].Value<int>(); });
+	std::cout << "benchmark_wide_groups: 12500 keys in " << small_time << "ms, 50000 keys in " << big_time << "ms" << std::endl;
+
+	// 4 times the keys, leave room for noise but not for quadratic time
+	ASSERT_EQUAL("benchmark_wide_groups", true, big_time < std::max(small_time, 1.0) * 8);
+	RETURN_TEST("benchmark_wide_groups", 0);
+}
+
+/**
+ * Builds a config with a single list of many distinct values
+ * @param items number of items
+ * @return config contents
+ */
+std::string long_list_config(const std::size_t& items) {
+	std::string config = "long = [";
+	for (std::size_t i = 0; i < items; i++)
+		config += " " + std::to_string(i);
+	config += " ]\n";
+	return config;
+}
+
+// Checking new list items for duplicates must not scan the list, so load time grows linearly with its size
+int benchmark_unique_lists() {
+	const std::string small = long_list_config(12500);
+	const std::string big = long_list_config(50000);
+
+	std::size_t count = 0;
+	const double small_time = measure([&small, &count]() { Config cfg; cfg << small; count += cfg["long"].Value<Item::List>().Size(); });
+	const double big_time = measure([&big, &count]() { Config cfg; cfg << big; count += cfg["long"].Value<Item::List>().Size(); });
+	std::cout << "benchmark_unique_lists: 12500 items in " << small_time << "ms, 50000 items in " << big_time << "ms" << std::endl;
+
+	// 4 times the items, leave room for noise but not for quadratic time
+	ASSERT_EQUAL("benchmark_unique_lists", true, big_time < std::max(small_time, 1.0) * 8);
+	RETURN_TEST("benchmark_unique_lists", 0);
+}
+
+// Packed lists must not be slower to load than the same values as items (while taking a fraction of the memory)
+int benchmark_packed_lists() {
+	const std::string packed = long_list_config(200000);
+	const std::string items = packed.substr(0, packed.size() - 2) + "\"end\" ]\n";
+
+	long long sum = 0;
+	const double items_time = measure([&items, &sum]() {
+		Config cfg; cfg << items;
+		for (const auto& item: cfg["long"].Value<Item::List>().Items())
+			if (item->Type() == Item::Type::Integer)
+				sum += item->Value<int>();
+	});
+	const double packed_time = measure([&packed, &sum]() {
+		Config cfg; cfg.PackMode(PackMode::Values); cfg << packed;
+		for (const int value: cfg["long"].Value<Item::List>().Span<int>())
+			sum += value;
+	});
+	std::cout << "benchmark_packed_lists: items " << items_time << "ms, packed " << packed_time << "ms" << std::endl;
+
+	ASSERT_EQUAL("benchmark_packed_lists", true, packed_time < items_time);
+	RETURN_TEST("benchmark_packed_lists", 0);
+}
+
+// Strings viewing the parsed text must not be slower to load than copied ones
+int benchmark_string_views() {
+	std::string config;
+	for (std::size_t i = 0; i < 100000; i++)
+		config += "key" + std::to_string(i) + " = \"" + std::string(64, static_cast<char>('a' + i % 26)) + "\"\n";
+
+	std::size_t length = 0;
+	const double copy_time = measure([&config, &length]() { Config cfg; cfg << config; length += cfg["key99999"].View().size(); });
+	const double view_time = measure([&config, &length]() { Config cfg; cfg.StringMode(StringMode::View); cfg << config; length += cfg["key99999"].View().size(); });
+	std::cout << "benchmark_string_views: copy " << copy_time << "ms, view " << view_time << "ms" << std::endl;
+
+	// Leave room for noise
+	ASSERT_EQUAL("benchmark_string_views", true, view_time < copy_time * 1.5);
+	RETURN_TEST("benchmark_string_views", 0);
+}
+
+// Copying a configuration must not depend on its size, and overriding a value in a copy only copies the groups on its path
+int benchmark_copy_on_write() {
+	Config small, big;
+	small << grouped_config(20, 30);
+	big << grouped_config(200, 300);
+
+	std::size_t length = 0;
+	const auto request = [&length](const Config& active) {
+		for (int i = 0; i < 10000; i++) {
+			Config copy = active;
+			copy["group10/item5"].Value<std::string>() = "override";
+			length += copy["group10/item5"].Value<std::string>().size();
+		}
+	};
+	const double small_time = measure([&request, &small]() { request(small); });
+	const double big_time = measure([&request, &big]() { request(big); });
+	std::cout << "benchmark_copy_on_write: 600 items in " << small_time << "ms, 60000 items in " << big_time << "ms" << std::endl;
+
+	// 100 times the items but 10 times the path width, leave room for noise but not for copying every item
+	ASSERT_EQUAL("benchmark_copy_on_write", true, big_time < std::max(small_time, 1.0) * 20);
+	RETURN_TEST("benchmark_copy_on_write", 0);
+}
+
+/**
+ * Builds a config with a long multi line string and a long block comment
+ * @param size size of each of them
+ * @return config contents
+ */
+std::string long_tokens_config(const std::size_t& size) {
+	std::string lines;
+	const std::string line = std::string(63, 'a') + "\n";
+	for (std::size_t length = 0; length < size; length += line.size())
+		lines += line;
+	return "text = \"" + lines + "\"\n/*\n" + lines + "*/\nlast = 1\n";
+}
+
+// Strings and comments spanning many chunks are read once they are closed, not again for every chunk
+int benchmark_incremental_long_tokens() {
+	const std::size_t megabyte = 1024 * 1024;
+	const std::string small = long_tokens_config(megabyte);
+	const std::string big = long_tokens_config(4 * megabyte);
+
+	Handler handler;
+	const auto feed = [&handler](const std::string& config) {
+		IncrementalParser parser(handler);
+		for (std::size_t position = 0; position < config.size(); position += 4096)
+			parser.Feed(std::span<const char>(config.data() + position, std::min<std::size_t>(4096, config.size() - position)));
+		parser.Finish();
+	};
+	const double small_time = measure([&small, &feed]() { feed(small); });
+	const double big_time = measure([&big, &feed]() { feed(big); });
+	std::cout << "benchmark_incremental_long_tokens: " << small.size() / megabyte << "MB in " << small_time << "ms, "
+		<< big.size() / megabyte << "MB in " << big_time << "ms" << std::endl;
+
+	// 4 times the input, linear growth is expected so leave room for noise but not for quadratic time
+	const bool linear = big_time < std::max(small_time, 1.0) * 8;
+	ASSERT_EQUAL("benchmark_incremental_long_tokens", true, linear);
+	RETURN_TEST("benchmark_incremental_long_tokens", 0);
+}
+
+int main() {
+	int result = 0;
+	try {
+		result += benchmark_long_single_line_strings();
+		result += benchmark_lazy_loading();
+		result += benchmark_arena_allocation();
+		result += benchmark_wide_groups();
+		result += benchmark_unique_lists();
+		result += benchmark_packed_lists();
+		result += benchmark_string_views();
+		result += benchmark_copy_on_write();
+		result += benchmark_incremental_long_tokens();
+	} catch (const StormByte::Config::Exception& ex) {
+		std::cerr << ex.what() << std::endl;
+		result++;
+	}
+	if (result == 0) {
+		std::cout << "All benchmarks passed!" << std::endl;
+	} else {
+		std::cout << result << " benchmarks failed." << std::endl;
+	}
+	return result;
+}
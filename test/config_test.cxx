@@ -8,6 +8,9 @@
 #include <fstream>
 #include <sstream>
 #include <climits>
+#include <atomic>
+#include <optional>
+#include <thread>
 
 using namespace StormByte::Config;
 
@@ -696,10 +699,11 @@ int on_name_clash_keep_existing() {
 	cfg.OnExistingAction(OnExistingAction::Keep);
 	cfg.Add(Item::Value("testItem", true));
 	try {
-		cfg.Add(Item::Value("testItem", 666));
+		const Item::Base& kept = cfg.Add(Item::Value("testItem", 666));
 		// Should not throw because action was set to keep existing
 		const Item::Base& item = cfg["testItem"];
 		ASSERT_EQUAL("on_name_clash_keep_existing", true, item.Value<bool>());
+		ASSERT_EQUAL("on_name_clash_keep_existing", &item, &kept);
 	}
 	catch(const StormByte::Config::Exception& ex) {
 		std::cerr << ex.what() << std::endl;
@@ -1052,6 +1056,1462 @@ int test_on_failure_hook() {
 	RETURN_TEST("test_on_failure_hook", result);
 }
 
+int test_string_view_input() {
+	int result = 0;
+	// Only the first part of the buffer is given, so the parser must not rely on a terminator
+	const std::string buffer = "testInt = 42\ntestString = \"In view\"\nnotParsed = ";
+	const std::string_view view(buffer.data(), buffer.find("notParsed"));
+	Config cfg;
+	try {
+		cfg << view;
+		ASSERT_EQUAL("test_string_view_input", 42, cfg["testInt"].Value<int>());
+		ASSERT_EQUAL("test_string_view_input", "In view", cfg["testString"].Value<std::string>());
+		ASSERT_EQUAL("test_string_view_input", false, cfg.Exists("notParsed"));
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+
+	RETURN_TEST("test_string_view_input", result);
+}
+
+int test_load_file() {
+	int result = 0;
+	Config loaded, streamed;
+	try {
+		loaded.LoadFile(CurrentFileDirectory / "files" / "complex_conf1.conf");
+		std::fstream file;
+		file.open(CurrentFileDirectory / "files" / "complex_conf1.conf", std::ios::in);
+		streamed << file;
+		file.close();
+		ASSERT_EQUAL("test_load_file", true, loaded == streamed);
+		ASSERT_EQUAL("test_load_file", 3, loaded["testGroup/testList2/3/testList/2"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+
+	try {
+		Config missing;
+		missing.LoadFile(CurrentFileDirectory / "files" / "non_existing.conf");
+		result = 1;
+	}
+	catch(const StormByte::Config::FileIOError&) {
+		// Expected
+	}
+
+	RETURN_TEST("test_load_file", result);
+}
+
+int test_numeric_parsing() {
+	int result = 0;
+	try {
+		Config cfg;
+		cfg << std::string("positive = +5\nnegative = -2147483648\nexp = 1.5e+3\nnegexp = -2.5E-2\n");
+		ASSERT_EQUAL("test_numeric_parsing", 5, cfg["positive"].Value<int>());
+		ASSERT_EQUAL("test_numeric_parsing", INT_MIN, cfg["negative"].Value<int>());
+		ASSERT_EQUAL("test_numeric_parsing", 1500.0, cfg["exp"].Value<double>());
+		ASSERT_EQUAL("test_numeric_parsing", -0.025, cfg["negexp"].Value<double>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+
+	// All of them should fail
+	const std::string bad_values[] = {
+		"value = 2147483648", "value = 1.0e400", "value = +-5", "value = 12abc",
+		"value = 1.e5", "value = 1.5e", "value = 3.14.15", "value = 1e5"
+	};
+	for (const auto& bad: bad_values) {
+		try {
+			Config cfg;
+			cfg << bad;
+			std::cerr << "test_numeric_parsing: " << bad << " was parsed" << std::endl;
+			result = 1;
+		}
+		catch(const StormByte::Config::ParseError&) {
+			// Expected
+		}
+	}
+
+	RETURN_TEST("test_numeric_parsing", result);
+}
+
+int test_string_escapes_at_any_position() {
+	int result = 0;
+	// Escapes and quotes placed around every offset of a vector sized chunk
+	for (std::size_t length = 0; length < 70; length++) {
+		for (std::size_t position = 0; position <= length; position += 7) {
+			const std::string prefix(position, 'x'), suffix(length - position, 'y');
+			Config cfg;
+			try {
+				cfg << "value = \"" + prefix + "\\\"\\n" + suffix + "\"";
+				ASSERT_EQUAL("test_string_escapes_at_any_position", prefix + "\"\n" + suffix, cfg["value"].Value<std::string>());
+			}
+			catch(const StormByte::Config::Exception& e) {
+				std::cerr << e.what() << std::endl;
+				RETURN_TEST("test_string_escapes_at_any_position", 1);
+			}
+		}
+	}
+	RETURN_TEST("test_string_escapes_at_any_position", result);
+}
+
+int test_error_line_after_long_spans() {
+	int result = 0;
+	std::string config_str = "/*";
+	for (int i = 0; i < 40; i++)
+		config_str += " * Comment line " + std::to_string(i) + " with some padding to be long enough\n";
+	config_str += "*/\nstring = \"";
+	for (int i = 0; i < 10; i++)
+		config_str += "String line " + std::to_string(i) + " with some padding to be long enough\n";
+	config_str += "\"\nbad = TRUE\n";
+	Config cfg;
+	try {
+		cfg << config_str;
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		// 40 comment lines, comment closure, 10 string lines, string closure and then the bad item
+		ASSERT_EQUAL("test_error_line_after_long_spans", std::string("Parse error on line 53: Unexpected T when parsing item type"), std::string(e.what()));
+	}
+	RETURN_TEST("test_error_line_after_long_spans", result);
+}
+
+class EventRecorder: public Handler {
+	public:
+		void OnGroupBegin(std::string_view name) override 							{ events += "group " + std::string(name) + ";"; }
+		void OnListBegin(std::string_view name) override 							{ events += "list " + std::string(name) + ";"; }
+		void OnEnd(const Item::ContainerType&) override 							{ events += "end;"; }
+		void OnValue(std::string_view name, int value) override 					{ events += std::string(name) + "=" + std::to_string(value) + ";"; }
+		void OnValue(std::string_view name, bool value) override 					{ events += std::string(name) + "=" + (value ? "true" : "false") + ";"; }
+		void OnValue(std::string_view name, std::string_view value) override 		{ events += std::string(name) + "=\"" + std::string(value) + "\";"; }
+		void OnComment(const Item::CommentType&, std::string_view text) override 	{ events += "#" + std::string(text) + ";"; }
+		std::string events;
+};
+
+int test_handler_events() {
+	int result = 0;
+	const std::string config_str = "# Settings\nname = \"plain\"\nserver = {\n\tport = 8080\n\ttags = [ \"a\\tb\" true ]\n}\n";
+	EventRecorder recorder;
+	try {
+		Parse(std::string_view(config_str), recorder);
+		ASSERT_EQUAL("test_handler_events", std::string("# Settings;name=\"plain\";group server;port=8080;list tags;=\"a\tb\";=true;end;end;"), recorder.events);
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_handler_events", 1);
+	}
+
+	// Errors are reported the same way than when building a Config
+	try {
+		EventRecorder bad_recorder;
+		std::istringstream input("group = {\n\tvalue = 1\n");
+		Parse(input, bad_recorder);
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError&) {
+		// Expected
+	}
+	RETURN_TEST("test_handler_events", result);
+}
+
+int test_reader_cursor() {
+	int result = 0;
+	const std::string config_str =
+		"# Shared file\n"
+		"cache = {\n\tpath = \"/tmp/{not a brace]\"\n\t// } neither\n\tsizes = [ 1 2 { a = 3 } ]\n\t/* ] nor [ */\n}\n"
+		"network = {\n\tport = 8080\n\tratio = 0.5\n\thost = \"local\\\"host\"\n\tenabled = true\n}\n";
+	try {
+		Reader reader(config_str);
+		Reader::Token token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.type == Reader::TokenType::Comment);
+		ASSERT_EQUAL("test_reader_cursor", std::string(" Shared file"), std::string(token.raw));
+
+		// Skip the whole cache group without parsing it
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.type == Reader::TokenType::GroupBegin);
+		ASSERT_EQUAL("test_reader_cursor", std::string("cache"), std::string(token.name));
+		reader.SkipValue();
+		ASSERT_EQUAL("test_reader_cursor", std::size_t(0), reader.Depth());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.type == Reader::TokenType::GroupBegin);
+		ASSERT_EQUAL("test_reader_cursor", std::string("network"), std::string(token.name));
+		ASSERT_EQUAL("test_reader_cursor", std::size_t(1), reader.Depth());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.kind == Item::Type::Integer);
+		ASSERT_EQUAL("test_reader_cursor", std::string("8080"), std::string(token.raw));
+		ASSERT_EQUAL("test_reader_cursor", 8080, token.AsInteger());
+		ASSERT_EQUAL("test_reader_cursor", 9u, token.Line());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.kind == Item::Type::Double);
+		ASSERT_EQUAL("test_reader_cursor", 0.5, token.AsDouble());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.kind == Item::Type::String);
+		ASSERT_EQUAL("test_reader_cursor", std::string("local\\\"host"), std::string(token.raw));
+		ASSERT_EQUAL("test_reader_cursor", std::string("local\"host"), token.AsString());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.kind == Item::Type::Bool && token.AsBool());
+
+		token = reader.Next();
+		ASSERT_EQUAL("test_reader_cursor", true, token.type == Reader::TokenType::End && token.container == Item::ContainerType::Group);
+		ASSERT_EQUAL("test_reader_cursor", true, reader.Next().type == Reader::TokenType::EoF);
+		ASSERT_EQUAL("test_reader_cursor", true, reader.Next().type == Reader::TokenType::EoF);
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_reader_cursor", 1);
+	}
+
+	// Skipping a container which is never closed is an error
+	try {
+		const std::string unclosed = "group = {\n\tlist = [ 1 2\n}\n";
+		Reader reader(unclosed);
+		reader.Next();
+		reader.SkipValue();
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError&) {
+		// Expected
+	}
+	RETURN_TEST("test_reader_cursor", result);
+}
+
+int test_lazy_parse_mode() {
+	int result = 0;
+	const std::string config_str =
+		"name = \"shared\"\n"
+		"server = {\n\tport = 8080\n\thosts = [ \"a\" \"b\" ]\n\tlimits = {\n\t\tmax = 10\n\t}\n}\n"
+		"broken = {\n\tvalue = 1\n\tbad = TRUE\n}\n";
+	try {
+		Config cfg;
+		cfg.ParseMode(ParseMode::Lazy);
+		cfg << config_str;
+		ASSERT_EQUAL("test_lazy_parse_mode", std::size_t(3), cfg.Size());
+		ASSERT_EQUAL("test_lazy_parse_mode", true, cfg[1].Value<Item::Container>().IsPending());
+		ASSERT_EQUAL("test_lazy_parse_mode", true, cfg[2].Value<Item::Container>().IsPending());
+
+		// Only the accessed path gets parsed
+		ASSERT_EQUAL("test_lazy_parse_mode", 8080, cfg["server/port"].Value<int>());
+		const Item::Container& server = cfg["server"].Value<Item::Container>();
+		ASSERT_EQUAL("test_lazy_parse_mode", false, server.IsPending());
+		ASSERT_EQUAL("test_lazy_parse_mode", true, server[1].Value<Item::Container>().IsPending());
+		ASSERT_EQUAL("test_lazy_parse_mode", true, server[2].Value<Item::Container>().IsPending());
+		ASSERT_EQUAL("test_lazy_parse_mode", std::string("b"), cfg["server/hosts/1"].Value<std::string>());
+		ASSERT_EQUAL("test_lazy_parse_mode", 10, cfg["server/limits/max"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_lazy_parse_mode", 1);
+	}
+
+	// Errors inside deferred containers are reported on access with their original line
+	try {
+		Config cfg;
+		cfg.ParseMode(ParseMode::Lazy);
+		cfg << config_str;
+		cfg["broken/value"];
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		ASSERT_EQUAL("test_lazy_parse_mode", std::string("Parse error on line 11: Unexpected T when parsing item type"), std::string(e.what()));
+	}
+
+	// Once parsed the result is the same than parsing eagerly
+	try {
+		const std::string valid_str = config_str.substr(0, config_str.find("broken"));
+		Config lazy, eager;
+		lazy.ParseMode(ParseMode::Lazy);
+		lazy << valid_str;
+		eager << valid_str;
+		ASSERT_EQUAL("test_lazy_parse_mode", static_cast<std::string>(eager), static_cast<std::string>(lazy));
+		ASSERT_EQUAL("test_lazy_parse_mode", eager.Count(), lazy.Count());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_lazy_parse_mode", 1);
+	}
+	RETURN_TEST("test_lazy_parse_mode", result);
+}
+
+int test_parallel_parse_mode() {
+	int result = 0;
+	// Big enough to be split, with brackets inside strings and comments which must not be matched
+	std::string config_str;
+	for (int group = 0; group < 2000; group++) {
+		config_str += "group" + std::to_string(group) + " = {\n";
+		config_str += "\t# closing } in a comment\n\t/* and ] in a\n\tmultiline one */\n";
+		config_str += "\tlist = [ \"}\" \"\\\"]\" { inner = [ 1 2 3 ] } ]\n";
+		for (int i = 0; i < 20; i++)
+			config_str += "\titem" + std::to_string(i) + " = \"value {" + std::to_string(i) + "\" // ]\n";
+		config_str += "}\n";
+	}
+
+	try {
+		Config parallel, eager;
+		parallel.ParseMode(ParseMode::Parallel);
+		parallel << config_str;
+		eager << config_str;
+		ASSERT_EQUAL("test_parallel_parse_mode", false, parallel["group1999"].Value<Item::Container>().IsPending());
+		ASSERT_EQUAL("test_parallel_parse_mode", std::string("}"), parallel["group10/list/0"].Value<std::string>());
+		ASSERT_EQUAL("test_parallel_parse_mode", eager.Count(), parallel.Count());
+		ASSERT_EQUAL("test_parallel_parse_mode", static_cast<std::string>(eager), static_cast<std::string>(parallel));
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_parallel_parse_mode", 1);
+	}
+
+	// Errors are the same than when parsing sequentially
+	const std::string broken_str = config_str + "broken = {\n\tbad = TRUE\n}\n";
+	std::string eager_error;
+	try {
+		Config eager;
+		eager << broken_str;
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		eager_error = e.what();
+	}
+	try {
+		Config parallel;
+		parallel.ParseMode(ParseMode::Parallel);
+		parallel << broken_str;
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		ASSERT_EQUAL("test_parallel_parse_mode", eager_error, std::string(e.what()));
+	}
+	RETURN_TEST("test_parallel_parse_mode", result);
+}
+
+int test_incremental_parser() {
+	int result = 0;
+	const std::string config_str =
+		"# Settings\nname = \"es\\\"caped\"\nserver = {\n\tport = 8080\n\t// } in a comment\n"
+		"\ttags = [ \"a\\tb\" true [ -12 ] ]\n\t/* multi\nline */\n\tenabled = false\n}\n"
+		"note = \"# not // a /* comment \\\\\" /* \"quoted\" */ // \"\n\tratio = 0.5 last = 1";
+	EventRecorder whole;
+	Parse(std::string_view(config_str), whole);
+
+	// Chunks split tokens anywhere, even inside strings, comments and numbers
+	for (std::size_t chunk_size = 1; chunk_size <= 8; chunk_size++) {
+		try {
+			EventRecorder recorder;
+			IncrementalParser parser(recorder);
+			for (std::size_t position = 0; position < config_str.size(); position += chunk_size)
+				parser.Feed(std::span<const char>(config_str.data() + position, std::min(chunk_size, config_str.size() - position)));
+			parser.Finish();
+			ASSERT_EQUAL("test_incremental_parser", whole.events, recorder.events);
+		}
+		catch(const StormByte::Config::Exception& e) {
+			std::cerr << e.what() << std::endl;
+			RETURN_TEST("test_incremental_parser", 1);
+		}
+	}
+
+	// Errors keep their line numbers
+	const std::string broken_str = "group = {\n\tvalue = 1\n\tbad = TRUE\n}\n";
+	try {
+		EventRecorder recorder;
+		IncrementalParser parser(recorder);
+		for (const char& c: broken_str)
+			parser.Feed(std::span<const char>(&c, 1));
+		parser.Finish();
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		ASSERT_EQUAL("test_incremental_parser", std::string("Parse error on line 3: Unexpected T when parsing item type"), std::string(e.what()));
+	}
+
+	// Unclosed containers are only reported when the input ends
+	try {
+		EventRecorder recorder;
+		IncrementalParser parser(recorder);
+		parser.Feed(std::span<const char>("group = {\n", 10));
+		ASSERT_EQUAL("test_incremental_parser", std::string("group group;"), recorder.events);
+		parser.Finish();
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError&) {
+		// Expected
+	}
+	RETURN_TEST("test_incremental_parser", result);
+}
+
+int test_discard_comments() {
+	const std::string config_str =
+		"# Header\nname = \"value\" // trailing\n/* block\ncomment */\n"
+		"server = {\n\t# inner\n\tport = 8080\n\tlist = [ 1 # one\n 2 ]\n}\n";
+	try {
+		Config cfg;
+		cfg.OnCommentAction(OnCommentAction::Discard);
+		cfg << config_str;
+		ASSERT_EQUAL("test_discard_comments", std::size_t(2), cfg.Size());
+		ASSERT_EQUAL("test_discard_comments", std::size_t(2), cfg["server"].Value<Item::Container>().Size());
+		ASSERT_EQUAL("test_discard_comments", std::size_t(2), cfg["server/list"].Value<Item::Container>().Size());
+		ASSERT_EQUAL("test_discard_comments", 8080, cfg["server/port"].Value<int>());
+		ASSERT_EQUAL("test_discard_comments", std::string::npos, static_cast<std::string>(cfg).find('#'));
+
+		// Lazily parsed containers discard them too when parsed
+		Config lazy;
+		lazy.OnCommentAction(OnCommentAction::Discard);
+		lazy.ParseMode(ParseMode::Lazy);
+		lazy << config_str;
+		ASSERT_EQUAL("test_discard_comments", static_cast<std::string>(cfg), static_cast<std::string>(lazy));
+
+		// Comments are kept by default
+		Config kept;
+		kept << config_str;
+		ASSERT_EQUAL("test_discard_comments", std::size_t(5), kept.Size());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_discard_comments", 1);
+	}
+	RETURN_TEST("test_discard_comments", 0);
+}
+
+int test_load_many() {
+	int result = 0;
+	try {
+		const auto files = CurrentFileDirectory / "files";
+		Config merged;
+		auto results = merged.LoadMany({ files / "good_double_conf1.conf", files / "non_existing.conf", files / "good_string_conf.conf", files / "bad_config1.conf" }, MergeMode::Move, 3);
+		ASSERT_EQUAL("test_load_many", std::size_t(4), results.size());
+		ASSERT_EQUAL("test_load_many", true, results[0].has_value());
+		ASSERT_EQUAL("test_load_many", false, results[1].has_value());
+		ASSERT_EQUAL("test_load_many", true, results[2].has_value());
+		ASSERT_EQUAL("test_load_many", false, results[3].has_value());
+		ASSERT_EQUAL("test_load_many", true, std::dynamic_pointer_cast<StormByte::Config::FileIOError>(results[1].error()) != nullptr);
+		ASSERT_EQUAL("test_load_many", true, std::dynamic_pointer_cast<StormByte::Config::ParseError>(results[3].error()) != nullptr);
+
+		// Items are merged in order and moved out of the results
+		ASSERT_EQUAL("test_load_many", std::size_t(4), merged.Size());
+		ASSERT_EQUAL("test_load_many", std::string("test_double"), *merged[0].Name());
+		ASSERT_EQUAL("test_load_many", std::string("test_string"), *merged[1].Name());
+		ASSERT_EQUAL("test_load_many", std::size_t(0), results[0]->Size());
+
+		// Without merge every input keeps its own items and the settings are shared
+		Config settings;
+		settings.OnExistingAction(OnExistingAction::Overwrite);
+		auto parsed = settings.ParseMany({ "a = 1\na = 2\n", "b = true\n" });
+		ASSERT_EQUAL("test_load_many", 2, (*parsed[0])["a"].Value<int>());
+		ASSERT_EQUAL("test_load_many", true, (*parsed[1])["b"].Value<bool>());
+		ASSERT_EQUAL("test_load_many", std::size_t(0), settings.Size());
+
+		// Merge follows OnExistingAction, and copied items are kept by the results
+		parsed = settings.ParseMany({ "a = 1\n", "a = 2\n" }, MergeMode::Copy);
+		ASSERT_EQUAL("test_load_many", 2, settings["a"].Value<int>());
+		ASSERT_EQUAL("test_load_many", 1, (*parsed[0])["a"].Value<int>());
+		settings["a"].Value<int>() = 3;
+		ASSERT_EQUAL("test_load_many", 2, (*parsed[1])["a"].Value<int>());
+
+		// Inputs with repeated names are not merged at all and report it in their place
+		Config strict;
+		strict << "b = 0\n";
+		parsed = strict.ParseMany({ "a = 1\n", "c = 2\nb = 2\n", "a = 3\n", "d = 4\n" }, MergeMode::Copy);
+		ASSERT_EQUAL("test_load_many", true, parsed[0].has_value());
+		ASSERT_EQUAL("test_load_many", false, parsed[1].has_value());
+		ASSERT_EQUAL("test_load_many", true, std::dynamic_pointer_cast<StormByte::Config::ItemNameAlreadyExists>(parsed[1].error()) != nullptr);
+		ASSERT_EQUAL("test_load_many", false, parsed[2].has_value());
+		ASSERT_EQUAL("test_load_many", true, parsed[3].has_value());
+		ASSERT_EQUAL("test_load_many", std::size_t(3), strict.Size());
+		ASSERT_EQUAL("test_load_many", 0, strict["b"].Value<int>());
+		ASSERT_EQUAL("test_load_many", 1, strict["a"].Value<int>());
+		ASSERT_EQUAL("test_load_many", false, strict.Exists("c"));
+		ASSERT_EQUAL("test_load_many", 4, strict["d"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_load_many", result);
+}
+
+int test_load_async() {
+	int result = 0;
+	const std::string config_str = "# Header\nname = \"value\"\nserver = {\n\tport = 8080\n\tlist = [ 1 2 3 ]\n}\nratio = 0.5\n";
+	try {
+		ThreadExecutor executor;
+		Config cfg, sync;
+		std::string order;
+		cfg.AddHookBeforeRead([&order](Item::Group&) { order += "before;"; });
+		cfg.AddHookAfterRead([&order](Item::Group& root) { order += "after " + std::to_string(root.Size()) + ";"; });
+		// Tiny slices so it yields many times, splitting tokens
+		auto res = cfg.LoadAsync(config_str, executor, 5).Get();
+		sync << config_str;
+		ASSERT_EQUAL("test_load_async", true, res.has_value());
+		ASSERT_EQUAL("test_load_async", std::string("before;after 4;"), order);
+		ASSERT_EQUAL("test_load_async", static_cast<std::string>(sync), static_cast<std::string>(cfg));
+
+		// Empty slices are parsed a byte at a time instead of never finishing
+		Config single;
+		auto single_res = single.LoadAsync(config_str, executor, 0).Get();
+		ASSERT_EQUAL("test_load_async", true, single_res.has_value());
+		ASSERT_EQUAL("test_load_async", static_cast<std::string>(sync), static_cast<std::string>(single));
+
+		// Errors are returned after running the failure hook
+		Config broken;
+		bool failure_called = false;
+		broken.OnParseFailure([&failure_called](const Item::Group&) { failure_called = true; return true; });
+		std::istringstream input("group = {\n\tvalue = 1\n\tbad = TRUE\n}\n");
+		auto broken_res = broken.LoadAsync(input, executor, 4).Get();
+		ASSERT_EQUAL("test_load_async", false, broken_res.has_value());
+		ASSERT_EQUAL("test_load_async", true, failure_called);
+		ASSERT_EQUAL("test_load_async", std::string("Parse error on line 3: Unexpected T when parsing item type"), std::string(broken_res.error()->what()));
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_load_async", result);
+}
+
+int test_include_directive() {
+	int result = 0;
+	const auto files = CurrentFileDirectory / "files";
+	try {
+		// Relative paths are resolved from the including file
+		Config tenant;
+		tenant.LoadFile(files / "include_main.conf");
+		ASSERT_EQUAL("test_include_directive", std::size_t(4), tenant.Size());
+		ASSERT_EQUAL("test_include_directive", 8080, tenant["defaults/port"].Value<int>());
+		ASSERT_EQUAL("test_include_directive", 30, tenant["timeout"].Value<int>());
+		ASSERT_EQUAL("test_include_directive", std::string("tenant"), tenant["name"].Value<std::string>());
+
+		// Included items are copies so changing them does not affect other includers
+		tenant["defaults/port"].Value<int>() = 9090;
+		Config other;
+		other << "nested = {\n\t@include \"" + (files / "include_defaults.conf").string() + "\"\n}\n";
+		ASSERT_EQUAL("test_include_directive", 8080, other["nested/defaults/port"].Value<int>());
+
+		// Includers share the cached items until changing them, also after the cache is cleared
+		Config first, second;
+		first.LoadFile(files / "include_main.conf");
+		second.LoadFile(files / "include_main.conf");
+		const Config& first_view = first;
+		const Config& second_view = second;
+		ASSERT_EQUAL("test_include_directive", &first_view["defaults/host"], &second_view["defaults/host"]);
+		Config::ClearIncludeCache();
+		Config third;
+		third.LoadFile(files / "include_main.conf");
+		const Config& third_view = third;
+		ASSERT_EQUAL("test_include_directive", true, &first_view["defaults/host"] != &third_view["defaults/host"]);
+		ASSERT_EQUAL("test_include_directive", std::string("localhost"), first_view["defaults/host"].Value<std::string>());
+
+		// Included references are resolved from every includer
+		const auto referencing = std::filesystem::temp_directory_path() / "stormbyte_config_include_references.conf";
+		std::ofstream(referencing) << "url = {\n\taddress = \"http://${host}/\"\n\tport = 80\n}\n";
+		const std::string include_referencing = "@include \"" + referencing.string() + "\"\n";
+		Config literal, resolving_a, resolving_b;
+		resolving_a.ReferenceMode(ReferenceMode::Resolve);
+		resolving_b.ReferenceMode(ReferenceMode::Resolve);
+		literal << "host = \"literal\"\n" + include_referencing;
+		resolving_a << "host = \"a\"\n" + include_referencing;
+		resolving_b << "host = \"b\"\n" + include_referencing;
+		std::filesystem::remove(referencing);
+		ASSERT_EQUAL("test_include_directive", std::string("http://${host}/"), literal["url/address"].Resolved());
+		ASSERT_EQUAL("test_include_directive", std::string("http://a/"), resolving_a["url/address"].Resolved());
+		ASSERT_EQUAL("test_include_directive", std::string("http://b/"), resolving_b["url/address"].Resolved());
+		const Config& resolving_a_view = resolving_a;
+		const Config& resolving_b_view = resolving_b;
+		ASSERT_EQUAL("test_include_directive", &resolving_a_view["url/port"], &resolving_b_view["url/port"]);
+
+		// Changed files are parsed again
+		const auto changing = std::filesystem::temp_directory_path() / "stormbyte_config_include_test.conf";
+		std::ofstream(changing) << "value = 1\n";
+		const std::string include_changing = "@include \"" + changing.string() + "\"\n";
+		Config before_change, after_change;
+		before_change << include_changing;
+		std::ofstream(changing) << "value = 22\n";
+		after_change << include_changing;
+		std::filesystem::remove(changing);
+		ASSERT_EQUAL("test_include_directive", 1, before_change["value"].Value<int>());
+		ASSERT_EQUAL("test_include_directive", 22, after_change["value"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_include_directive", 1);
+	}
+
+	const std::vector<std::string> bad_configs {
+		"list = [ 1 @include \"" + (files / "include_defaults.conf").string() + "\" ]\n",
+		"value = 1\n@include \"non_existing.conf\"\n",
+		"@import \"other.conf\"\n"
+	};
+	for (const auto& bad_config: bad_configs) {
+		try {
+			Config cfg;
+			cfg << bad_config;
+			result++;
+		}
+		catch(const StormByte::Config::ParseError&) {
+			// Expected
+		}
+	}
+
+	// Include cycles are reported instead of recursing forever
+	try {
+		Config cfg;
+		cfg.LoadFile(files / "include_cycle_a.conf");
+		result++;
+	}
+	catch(const StormByte::Config::ParseError& e) {
+		ASSERT_EQUAL("test_include_directive", true, std::string(e.what()).find("Include cycle") != std::string::npos);
+	}
+	RETURN_TEST("test_include_directive", result);
+}
+
+int test_interpolation() {
+	int result = 0;
+	const std::string config_str = "server = {\n\thost = \"localhost\"\n\tport = 8080\n}\nurl = \"http://${server/host}:${server/port}/\"\nliteral = \"$${server/host}\"\n";
+	try {
+		// References are plain text unless asked for
+		Config plain;
+		plain << "price = \"${price}\"\n";
+		ASSERT_EQUAL("test_interpolation", std::string("${price}"), plain["price"].Value<std::string>());
+		ASSERT_EQUAL("test_interpolation", std::string("${price}"), plain["price"].Resolved());
+
+		Config cfg;
+		cfg.ReferenceMode(ReferenceMode::Resolve);
+		cfg << config_str;
+		ASSERT_EQUAL("test_interpolation", std::string("http://localhost:8080/"), cfg["url"].Resolved());
+		ASSERT_EQUAL("test_interpolation", std::string("${server/host}"), cfg["literal"].Resolved());
+
+		// Values are read and changed as written
+		ASSERT_EQUAL("test_interpolation", std::string("http://${server/host}:${server/port}/"), cfg["url"].Value<std::string>());
+		cfg["url"].Value<std::string>() = "https://${server/host}/";
+		ASSERT_EQUAL("test_interpolation", std::string("https://localhost/"), cfg["url"].Resolved());
+		cfg["url"].Value<std::string>() = "http://${server/host}:${server/port}/";
+
+		// Changed and replaced items are noticed
+		cfg["server/port"].Value<int>() = 9090;
+		cfg.Remove("server/host");
+		cfg["server"].Value<Item::Group>().Add(Item::Value<std::string>("host", "example.com"));
+		ASSERT_EQUAL("test_interpolation", std::string("http://example.com:9090/"), cfg["url"].Resolved());
+
+		// References are written as they were read
+		std::string serialized;
+		cfg >> serialized;
+		ASSERT_EQUAL("test_interpolation", true, serialized.find("${server/host}") != std::string::npos);
+
+		// Copies resolve from their own items, even once the original is gone
+		std::optional<Config> original = cfg;
+		Config copy = *original;
+		ASSERT_EQUAL("test_interpolation", std::string("http://example.com:9090/"), copy["url"].Resolved());
+		copy["server/host"].Value<std::string>() = "copy.example.com";
+		ASSERT_EQUAL("test_interpolation", std::string("http://copy.example.com:9090/"), copy["url"].Resolved());
+		ASSERT_EQUAL("test_interpolation", std::string("http://example.com:9090/"), (*original)["url"].Resolved());
+		original.reset();
+		ASSERT_EQUAL("test_interpolation", std::string("http://copy.example.com:9090/"), copy["url"].Resolved());
+
+		// Moved configurations resolve from their new root
+		Config moved = std::move(cfg);
+		ASSERT_EQUAL("test_interpolation", std::string("http://example.com:9090/"), moved["url"].Resolved());
+
+		// Resolved values can be read concurrently
+		std::vector<std::thread> readers;
+		std::atomic<int> mismatches = 0;
+		const Config& reader = moved;
+		for (int thread = 0; thread < 4; thread++) {
+			readers.emplace_back([&reader, &mismatches]() {
+				for (int read = 0; read < 1000; read++) {
+					if (reader["url"].Resolved() != "http://example.com:9090/")
+						mismatches++;
+				}
+			});
+		}
+		for (auto& thread: readers)
+			thread.join();
+		ASSERT_EQUAL("test_interpolation", 0, mismatches.load());
+
+		// Lazily parsed containers resolve from the configuration root too, copies included
+		Config lazy;
+		lazy.ParseMode(ParseMode::Lazy);
+		lazy.ReferenceMode(ReferenceMode::Resolve);
+		lazy << "name = \"app\"\nlog = {\n\tfile = \"/var/log/${name}.log\"\n}\n";
+		Config lazy_copy = lazy;
+		lazy_copy["name"].Value<std::string>() = "copy";
+		ASSERT_EQUAL("test_interpolation", std::string("/var/log/app.log"), lazy["log/file"].Resolved());
+		ASSERT_EQUAL("test_interpolation", std::string("/var/log/copy.log"), lazy_copy["log/file"].Resolved());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_interpolation", 1);
+	}
+
+	// Missing items and cycles are reported when read
+	const std::vector<std::string> bad_configs {
+		"value = \"${missing}\"\n",
+		"value = \"${other}\"\nother = \"${value}\"\n",
+		"value = \"${group}\"\ngroup = {\n\tinner = 1\n}\n"
+	};
+	for (const auto& bad_config: bad_configs) {
+		Config cfg;
+		cfg.ReferenceMode(ReferenceMode::Resolve);
+		cfg << bad_config;
+		try {
+			const std::string value = cfg["value"].Resolved();
+			result++;
+		}
+		catch(const StormByte::Config::Exception&) {
+			// Expected
+		}
+	}
+	RETURN_TEST("test_interpolation", result);
+}
+
+int test_source_location() {
+	int result = 0;
+	const auto files = CurrentFileDirectory / "files";
+	try {
+		// Locations are only kept when asked for
+		Config discarded;
+		discarded << "first = 1\n";
+		ASSERT_EQUAL("test_source_location", false, discarded.SourceLocation("first").has_value());
+
+		Config cfg;
+		cfg.LocationMode(LocationMode::Keep);
+		cfg << "first = 1\ngroup = {\n\tname = \"x\"\n\tlist = [ 1 2 ]\n}\n";
+		auto location = cfg.SourceLocation("group/name");
+		ASSERT_EQUAL("test_source_location", true, location.has_value());
+		ASSERT_EQUAL("test_source_location", 3u, location->line);
+		ASSERT_EQUAL("test_source_location", 2u, location->column);
+		location = cfg.SourceLocation("group/list/1");
+		ASSERT_EQUAL("test_source_location", 4u, location->line);
+		ASSERT_EQUAL("test_source_location", 13u, location->column);
+		ASSERT_EQUAL("test_source_location", 1u, cfg.SourceLocation("first")->line);
+
+		// Items added by code have no location
+		cfg.Add(Item::Value<int>("added", 1));
+		ASSERT_EQUAL("test_source_location", false, cfg.SourceLocation("added").has_value());
+		// Even when they take the place of a removed one
+		cfg.Remove("first");
+		cfg.Add(Item::Value<int>("first", 3));
+		ASSERT_EQUAL("test_source_location", false, cfg.SourceLocation("first").has_value());
+
+		// Files and their includes are reported with their own path
+		Config tenant;
+		tenant.ParseMode(ParseMode::Lazy);
+		tenant.LocationMode(LocationMode::Keep);
+		tenant.LoadFile(files / "include_main.conf");
+		location = tenant.SourceLocation("name");
+		ASSERT_EQUAL("test_source_location", std::string("include_main.conf"), location->file.filename().string());
+		ASSERT_EQUAL("test_source_location", 3u, location->line);
+		location = tenant.SourceLocation("defaults/host");
+		ASSERT_EQUAL("test_source_location", std::string("include_defaults.conf"), location->file.filename().string());
+		ASSERT_EQUAL("test_source_location", 3u, location->line);
+		ASSERT_EQUAL("test_source_location", 2u, location->column);
+
+		// Entries of destroyed items are dropped while the kept ones are still found
+		Config churn;
+		churn.ParseMode(ParseMode::Lazy);
+		churn.LocationMode(LocationMode::Keep);
+		std::string groups;
+		for (int i = 0; i < 3000; i++)
+			groups += "g" + std::to_string(i) + " = {\n\tv = " + std::to_string(i) + "\n}\n";
+		churn << groups;
+		for (int i = 0; i < 2999; i++) {
+			ASSERT_EQUAL("test_source_location", i, churn["g" + std::to_string(i) + "/v"].Value<int>());
+			churn.Remove("g" + std::to_string(i));
+		}
+		location = churn.SourceLocation("g2999/v");
+		ASSERT_EQUAL("test_source_location", true, location.has_value());
+		ASSERT_EQUAL("test_source_location", 2999u * 3u + 2u, location->line);
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		RETURN_TEST("test_source_location", 1);
+	}
+	RETURN_TEST("test_source_location", result);
+}
+
+int test_arena_allocation() {
+	int result = 0;
+	const std::string config_str = "# Header\nname = \"value ${server/port}\"\nserver = {\n\tport = 8080\n\tlist = [ 1 2 [ true false ] ]\n}\nratio = 0.5\n";
+	try {
+		Config heap;
+		heap << config_str;
+		for (const auto mode: { ParseMode::Eager, ParseMode::Lazy, ParseMode::Parallel }) {
+			Config cfg;
+			cfg.AllocationMode(AllocationMode::Arena);
+			cfg.ParseMode(mode);
+			cfg.ReferenceMode(ReferenceMode::Resolve);
+			cfg << config_str;
+			ASSERT_EQUAL("test_arena_allocation", static_cast<std::string>(heap), static_cast<std::string>(cfg));
+			ASSERT_EQUAL("test_arena_allocation", std::string("value 8080"), cfg["name"].Resolved());
+		}
+
+		// Copies keep the arena alive, also for containers parsed after the original is gone
+		std::optional<Config> copy;
+		{
+			Config original;
+			original.AllocationMode(AllocationMode::Arena);
+			original.ParseMode(ParseMode::Lazy);
+			original << config_str;
+			copy = original;
+		}
+		ASSERT_EQUAL("test_arena_allocation", true, (*copy)["server/list/2/0"].Value<bool>());
+		copy->Remove("server");
+		*copy << "server = { port = 1 }\n";
+		ASSERT_EQUAL("test_arena_allocation", 1, (*copy)["server/port"].Value<int>());
+
+		// Merged items keep the arena of the configuration they were loaded into
+		Config merged;
+		merged.AllocationMode(AllocationMode::Arena);
+		merged.ParseMany({ "a = [ 1 2 3 ]\n", "b = { c = \"text\" }\n" }, MergeMode::Move).clear();
+		ASSERT_EQUAL("test_arena_allocation", 3, merged["a/2"].Value<int>());
+		ASSERT_EQUAL("test_arena_allocation", std::string("text"), merged["b/c"].Value<std::string>());
+
+		// Cloned items do not depend on it
+		Config cloned;
+		{
+			Config source;
+			source.AllocationMode(AllocationMode::Arena);
+			source << config_str;
+			cloned << source;
+		}
+		ASSERT_EQUAL("test_arena_allocation", 8080, cloned["server/port"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_arena_allocation", result);
+}
+
+int test_item_ownership() {
+	int result = 0;
+	try {
+		// Moved in pointers are not shared
+		Item::Group group;
+		Item::Base::PointerType item = Item::Base::MakePointer<Item::Value<int>>(1);
+		item->Name("value");
+		const Item::Base* address = item.get();
+		Item::Base& added = group.Add(std::move(item), OnExistingAction::ThrowException);
+		ASSERT_EQUAL("test_item_ownership", address, &added);
+		ASSERT_EQUAL("test_item_ownership", 1L, group.Items()[0].use_count());
+
+		// Neither are merged nor copied items
+		Config merged;
+		merged.ParseMany({ "a = 1\n", "b = [ 1 2 ]\n" }, MergeMode::Move);
+		ASSERT_EQUAL("test_item_ownership", 1L, merged.Items()[0].use_count());
+		ASSERT_EQUAL("test_item_ownership", 1L, merged.Items()[1].use_count());
+		Config copied;
+		copied << merged;
+		ASSERT_EQUAL("test_item_ownership", 1L, merged.Items()[0].use_count());
+		ASSERT_EQUAL("test_item_ownership", 1L, copied.Items()[0].use_count());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_item_ownership", result);
+}
+
+int test_item_visit() {
+	int result = 0;
+	try {
+		Config cfg;
+		cfg << "# Comment\nnumber = 3\nratio = 0.5\nflag = true\ntext = \"hi\"\nlist = [ 1 2 ]\n";
+		std::string visited;
+		for (const auto& item: cfg.Items()) {
+			visited += Item::Visit(*item, [](const auto& value) -> std::string {
+				using Kind = std::remove_cvref_t<decltype(value)>;
+				if constexpr (std::is_same_v<Kind, Item::Value<int>>)
+					return "i" + std::to_string(*value);
+				else if constexpr (std::is_same_v<Kind, Item::Value<double>>)
+					return "d";
+				else if constexpr (std::is_same_v<Kind, Item::Value<bool>>)
+					return *value ? "t" : "f";
+				else if constexpr (std::is_same_v<Kind, Item::Value<std::string>>)
+					return "s" + *value;
+				else if constexpr (std::is_same_v<Kind, Item::Container>)
+					return "c" + std::to_string(value.Size());
+				else
+					return "#";
+			}) + ";";
+		}
+		ASSERT_EQUAL("test_item_visit", std::string("#;i3;d;t;shi;c2;"), visited);
+
+		// Types are kept by copies and values are only reached as their own type
+		ASSERT_EQUAL("test_item_visit", true, cfg.Items()[0]->Clone()->Type() == Item::Type::Comment);
+		ASSERT_EQUAL("test_item_visit", std::string(" Comment"), cfg.Items()[0]->Value<std::string>());
+		bool thrown = false;
+		try {
+			(void)cfg["text"].Value<int>();
+		}
+		catch (const WrongValueTypeConversion&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_item_visit", true, thrown);
+		thrown = false;
+		try {
+			(void)cfg["number"].Value<Item::Group>();
+		}
+		catch (const WrongValueTypeConversion&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_item_visit", true, thrown);
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_item_visit", result);
+}
+
+int test_interned_names() {
+	int result = 0;
+	try {
+		Config first, second;
+		first << "tenant_port = 1\ntenant_group = { tenant_host = \"a\" }\n";
+		const std::size_t interned = Item::SymbolTable::Size();
+		second << "tenant_port = 2\ntenant_group = { tenant_host = \"b\" }\n";
+
+		// Same names share their storage and nothing new is interned
+		ASSERT_EQUAL("test_interned_names", interned, Item::SymbolTable::Size());
+		ASSERT_EQUAL("test_interned_names", first["tenant_group/tenant_host"].Symbol(), second["tenant_group/tenant_host"].Symbol());
+		ASSERT_EQUAL("test_interned_names", &*first["tenant_port"].Name(), &*second["tenant_port"].Name());
+		ASSERT_EQUAL("test_interned_names", std::string("tenant_port"), *second["tenant_port"].Name());
+
+		// Looking up a name no item ever had interns nothing
+		ASSERT_EQUAL("test_interned_names", false, first.Exists("tenant_never_used_name"));
+		ASSERT_EQUAL("test_interned_names", true, Item::SymbolTable::Find("tenant_never_used_name") == nullptr);
+
+		// Renamed items get the symbol of their new name
+		Item::Value<int> value("tenant_other", 3);
+		value.Name("tenant_port");
+		ASSERT_EQUAL("test_interned_names", first["tenant_port"].Symbol(), value.Symbol());
+		ASSERT_EQUAL("test_interned_names", false, first.Items()[0]->Clone()->Symbol() != value.Symbol());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_interned_names", result);
+}
+
+int test_group_index() {
+	int result = 0;
+	try {
+		std::string config_str = "big = {\n";
+		for (int i = 0; i < 1000; i++)
+			config_str += "\tkey" + std::to_string(i) + " = " + std::to_string(i) + "\n";
+		config_str += "}\n";
+		Config cfg;
+		cfg << config_str;
+		Item::Group& big = cfg["big"].Value<Item::Group>();
+		ASSERT_EQUAL("test_group_index", std::size_t(1000), big.Size());
+		ASSERT_EQUAL("test_group_index", 999, big["key999"].Value<int>());
+
+		// Order is kept through removals and overwrites
+		big.Remove("key0");
+		big.Remove(std::size_t(0));
+		ASSERT_EQUAL("test_group_index", false, big.Exists("key1"));
+		ASSERT_EQUAL("test_group_index", 500, big["key500"].Value<int>());
+		big.Add(Item::Value<int>("key500", -1), OnExistingAction::Overwrite);
+		ASSERT_EQUAL("test_group_index", -1, big["key500"].Value<int>());
+		ASSERT_EQUAL("test_group_index", std::string("key500"), *big.Items().back()->Name());
+		ASSERT_EQUAL("test_group_index", 501, big["key501"].Value<int>());
+		big.Add(Item::Value<int>("key0", 0), OnExistingAction::ThrowException);
+		ASSERT_EQUAL("test_group_index", 0, big["key0"].Value<int>());
+
+		bool thrown = false;
+		try {
+			big.Add(Item::Value<int>("key7", 7), OnExistingAction::ThrowException);
+		}
+		catch (const ItemNameAlreadyExists&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_group_index", true, thrown);
+
+		// Copies and moves keep finding their items
+		Item::Group copy = big;
+		copy.Remove("key2");
+		ASSERT_EQUAL("test_group_index", true, big.Exists("key2"));
+		ASSERT_EQUAL("test_group_index", false, copy.Exists("key2"));
+		ASSERT_EQUAL("test_group_index", 998, copy["key998"].Value<int>());
+		Item::Group moved = std::move(copy);
+		ASSERT_EQUAL("test_group_index", 3, moved["key3"].Value<int>());
+
+		// Items replaced in place are still found
+		big.Items()[0] = Item::Base::MakePointer<Item::Value<int>>(Item::Value<int>("key2", 22));
+		ASSERT_EQUAL("test_group_index", 22, big["key2"].Value<int>());
+
+		// Items renamed or replaced under another name are found by it, which can not be added again
+		big["key3"].Name("renamed");
+		ASSERT_EQUAL("test_group_index", 3, big["renamed"].Value<int>());
+		ASSERT_EQUAL("test_group_index", false, big.Exists("key3"));
+		thrown = false;
+		try {
+			big.Add(Item::Value<int>("renamed", 0), OnExistingAction::ThrowException);
+		}
+		catch (const ItemNameAlreadyExists&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_group_index", true, thrown);
+		big.Add(Item::Value<int>("key3", 33));
+		ASSERT_EQUAL("test_group_index", 33, big["key3"].Value<int>());
+		big.Items()[1] = Item::Base::MakePointer<Item::Value<int>>(Item::Value<int>("replaced", 4));
+		ASSERT_EQUAL("test_group_index", true, big.Exists("replaced"));
+		thrown = false;
+		try {
+			big.Add(Item::Value<int>("replaced", 0), OnExistingAction::ThrowException);
+		}
+		catch (const ItemNameAlreadyExists&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_group_index", true, thrown);
+
+		// Names swapped between additions are found by their new names
+		big["key10"].Name("swap");
+		big["key11"].Name("key10");
+		big["swap"].Name("key11");
+		ASSERT_EQUAL("test_group_index", 11, big["key10"].Value<int>());
+		ASSERT_EQUAL("test_group_index", 10, big["key11"].Value<int>());
+		big.Add(Item::Value<int>("swap", 0));
+		ASSERT_EQUAL("test_group_index", 11, big["key10"].Value<int>());
+		ASSERT_EQUAL("test_group_index", 10, big["key11"].Value<int>());
+		ASSERT_EQUAL("test_group_index", 0, big["swap"].Value<int>());
+
+		big.Clear();
+		ASSERT_EQUAL("test_group_index", false, big.Exists("key999"));
+		big.Add(Item::Value<int>("key999", 1));
+		ASSERT_EQUAL("test_group_index", 1, big["key999"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_group_index", result);
+}
+
+int test_list_duplicates() {
+	int result = 0;
+	try {
+		// Equal items are found whatever the list size
+		std::string config_str = "small = [ 1 \"a\" [ 2 3 ] ]\nbig = [ ";
+		for (int i = 0; i < 100; i++)
+			config_str += std::to_string(i) + " ";
+		config_str += "]\n";
+		Config cfg;
+		cfg << config_str;
+		Item::List& small = cfg["small"].Value<Item::List>();
+		Item::List& big = cfg["big"].Value<Item::List>();
+		ASSERT_EQUAL("test_list_duplicates", true, big.Mode() == ListMode::Unique);
+
+		for (Item::List* list: { &small, &big }) {
+			const std::size_t size = list->Size();
+			bool thrown = false;
+			try {
+				list->Add(Item::Value<int>(1), OnExistingAction::ThrowException);
+			}
+			catch (const ItemAlreadyExists&) {
+				thrown = true;
+			}
+			ASSERT_EQUAL("test_list_duplicates", true, thrown);
+			ASSERT_EQUAL("test_list_duplicates", size, list->Size());
+			list->Add(Item::Value<int>(1), OnExistingAction::Keep);
+			ASSERT_EQUAL("test_list_duplicates", size, list->Size());
+			list->Add(Item::Value<int>(1), OnExistingAction::Overwrite);
+			ASSERT_EQUAL("test_list_duplicates", size, list->Size());
+			ASSERT_EQUAL("test_list_duplicates", 1, list->Items().back()->Value<int>());
+			list->Add(Item::Value<int>(-1), OnExistingAction::ThrowException);
+			ASSERT_EQUAL("test_list_duplicates", size + 1, list->Size());
+		}
+
+		// Values of different types and containers are compared by content
+		small.Add(Item::Value<double>(1.0), OnExistingAction::ThrowException);
+		Item::List nested;
+		nested.Add(Item::Value<int>(2));
+		nested.Add(Item::Value<int>(3));
+		bool thrown = false;
+		try {
+			small.Add(nested, OnExistingAction::ThrowException);
+		}
+		catch (const ItemAlreadyExists&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_list_duplicates", true, thrown);
+		nested.Add(Item::Value<int>(4));
+		small.Add(nested, OnExistingAction::ThrowException);
+
+		// Duplicates found while parsing follow the configured action
+		thrown = false;
+		try {
+			Config duplicated;
+			duplicated << "list = [ 1 1 ]";
+		}
+		catch (const StormByte::Config::Exception&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_list_duplicates", true, thrown);
+
+		Config kept;
+		kept.OnExistingAction(OnExistingAction::Keep);
+		kept << "list = [ 1 2 1 2 ]";
+		ASSERT_EQUAL("test_list_duplicates", std::size_t(2), kept["list"].Value<Item::List>().Size());
+
+		// Appending lists keep every item
+		Config appended;
+		appended.ListMode(ListMode::Append);
+		appended << "list = [ 1 1 [ 1 1 ] ]";
+		Item::List& list = appended["list"].Value<Item::List>();
+		ASSERT_EQUAL("test_list_duplicates", true, list.Mode() == ListMode::Append);
+		ASSERT_EQUAL("test_list_duplicates", std::size_t(3), list.Size());
+		ASSERT_EQUAL("test_list_duplicates", std::size_t(2), appended["list/2"].Value<Item::List>().Size());
+		list.Add(Item::Value<int>(1), OnExistingAction::ThrowException);
+		ASSERT_EQUAL("test_list_duplicates", std::size_t(4), list.Size());
+
+		// Switching back to unique does not remove existing duplicates but checks new items
+		list.Mode(ListMode::Unique);
+		list.Add(Item::Value<int>(1), OnExistingAction::Keep);
+		ASSERT_EQUAL("test_list_duplicates", std::size_t(4), list.Size());
+
+		// Lists are equal when their items are
+		Config first, second, third;
+		first << "list = [ 1 [ 2 \"a\" ] ]";
+		second << "list = [ 1 [ 2 \"a\" ] ]";
+		third << "list = [ 1 [ 2 \"b\" ] ]";
+		ASSERT_EQUAL("test_list_duplicates", true, first["list"].Value<Item::List>() == second["list"].Value<Item::List>());
+		ASSERT_EQUAL("test_list_duplicates", false, first["list"].Value<Item::List>() == third["list"].Value<Item::List>());
+		ASSERT_EQUAL("test_list_duplicates", false, Item::Equal(first["list"], third["list"]));
+		ASSERT_EQUAL("test_list_duplicates", Item::Hash(first["list"]), Item::Hash(second["list"]));
+
+		// Comparisons follow changes made after them by path or index
+		second["list/1/1"].Value<std::string>() = "b";
+		ASSERT_EQUAL("test_list_duplicates", false, first["list"].Value<Item::List>() == second["list"].Value<Item::List>());
+		ASSERT_EQUAL("test_list_duplicates", true, second["list"].Value<Item::List>() == third["list"].Value<Item::List>());
+		second["list"].Value<Item::List>()[1].Value<Item::List>()[1].Value<std::string>() = "c";
+		ASSERT_EQUAL("test_list_duplicates", false, second["list"].Value<Item::List>() == third["list"].Value<Item::List>());
+		third["list/1/1"].Value<std::string>() = "c";
+		ASSERT_EQUAL("test_list_duplicates", true, second["list"].Value<Item::List>() == third["list"].Value<Item::List>());
+
+		// Items changed in place are checked by their new values
+		const int former = big[5].Value<int>();
+		big[5].Value<int>() = 1000;
+		cfg["big/6"].Value<int>() = 2000;
+		Item::Base& added = big.Add(Item::Value<int>(3000));
+		added.Value<int>() = 4000;
+		for (const int value: { 1000, 2000, 4000 }) {
+			thrown = false;
+			try {
+				big.Add(Item::Value<int>(value), OnExistingAction::ThrowException);
+			}
+			catch (const ItemAlreadyExists&) {
+				thrown = true;
+			}
+			ASSERT_EQUAL("test_list_duplicates", true, thrown);
+		}
+		big.Add(Item::Value<int>(former), OnExistingAction::ThrowException);
+
+		// Lazily parsed containers are checked as the eagerly parsed ones (once the list is accessed)
+		for (const ParseMode mode: { ParseMode::Eager, ParseMode::Lazy }) {
+			thrown = false;
+			try {
+				Config containers;
+				containers.ParseMode(mode);
+				containers << "list = [ { a = 1 } { a = 1 } ]";
+				(void)containers.Count();
+			}
+			catch (const StormByte::Config::Exception&) {
+				thrown = true;
+			}
+			ASSERT_EQUAL("test_list_duplicates", true, thrown);
+		}
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_list_duplicates", result);
+}
+
+int test_packed_lists() {
+	int result = 0;
+	try {
+		std::string config_str = "ints = [";
+		for (int i = 0; i < 1000; i++)
+			config_str += " " + std::to_string(i);
+		config_str += " ]\ndoubles = [";
+		for (int i = 0; i < 20; i++)
+			config_str += " " + std::to_string(i) + ".5";
+		config_str += " ]\nsmall = [ 1 2 ]\nmixed = [";
+		for (int i = 0; i < 20; i++)
+			config_str += " " + std::to_string(i);
+		config_str += " \"a\" ]\nnested = [ [";
+		for (int i = 0; i < 20; i++)
+			config_str += " " + std::to_string(i);
+		config_str += " ] ]\n";
+		Config cfg;
+		cfg.PackMode(PackMode::Values);
+		cfg << config_str;
+		const std::string serialized = cfg;
+
+		// Lists are only packed when asked to
+		Config plain;
+		plain << config_str;
+		ASSERT_EQUAL("test_packed_lists", false, plain["ints"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", serialized, static_cast<std::string>(plain));
+
+		// Values are kept packed while read through spans, sizes and serialization
+		Item::List& ints = cfg["ints"].Value<Item::List>();
+		ASSERT_EQUAL("test_packed_lists", true, ints.IsPacked());
+		ASSERT_EQUAL("test_packed_lists", std::size_t(1000), ints.Size());
+		const std::span<const int> span = ints.Span<int>();
+		ASSERT_EQUAL("test_packed_lists", std::size_t(1000), span.size());
+		ASSERT_EQUAL("test_packed_lists", 999, span[999]);
+		ASSERT_EQUAL("test_packed_lists", 1.5, cfg["doubles"].Value<Item::List>().Span<double>()[1]);
+		ASSERT_EQUAL("test_packed_lists", std::size_t(1000 + 20 + 2 + 21 + 21 + 5), cfg.Count());
+		ASSERT_EQUAL("test_packed_lists", true, cfg["nested/0"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", true, ints.IsPacked());
+
+		// Few values or values mixed with other items are not packed
+		ASSERT_EQUAL("test_packed_lists", false, cfg["small"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", false, cfg["mixed"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", 19, cfg["mixed/19"].Value<int>());
+		ASSERT_EQUAL("test_packed_lists", std::string("a"), cfg["mixed/20"].Value<std::string>());
+
+		bool thrown = false;
+		try {
+			ints.Span<double>();
+		}
+		catch (const WrongValueTypeConversion&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_packed_lists", true, thrown);
+
+		// Const access does not unpack them (it may run concurrently), non const access unpacks them once
+		Config copy;
+		copy.PackMode(PackMode::Values);
+		copy << config_str;
+		const Config& reader = copy;
+		const Item::Base& five = reader["ints/5"];
+		ASSERT_EQUAL("test_packed_lists", 5, five.Value<int>());
+		const Item::List& const_ints = reader["ints"].Value<Item::List>();
+		ASSERT_EQUAL("test_packed_lists", 998, const_ints[998].Value<int>());
+		long sum = 0;
+		for (const auto& item: const_ints.Items())
+			sum += item->Value<int>();
+		ASSERT_EQUAL("test_packed_lists", 999L * 1000L / 2L, sum);
+		ASSERT_EQUAL("test_packed_lists", true, const_ints.IsPacked());
+		ASSERT_EQUAL("test_packed_lists", true, reader.Exists("ints/999"));
+		ASSERT_EQUAL("test_packed_lists", false, reader.Exists("ints/1000"));
+		ASSERT_EQUAL("test_packed_lists", false, reader.Exists("ints/5/x"));
+		ASSERT_EQUAL("test_packed_lists", true, reader["ints"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", 500, cfg["ints/500"].Value<int>());
+		ASSERT_EQUAL("test_packed_lists", false, ints.IsPacked());
+		ASSERT_EQUAL("test_packed_lists", 7, ints[7].Value<int>());
+		ASSERT_EQUAL("test_packed_lists", serialized, static_cast<std::string>(cfg));
+		ASSERT_EQUAL("test_packed_lists", true, ints == copy["ints"].Value<Item::List>());
+		ASSERT_EQUAL("test_packed_lists", Item::Hash(ints), Item::Hash(copy["ints"]));
+		ASSERT_EQUAL("test_packed_lists", true, copy["ints"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", 6, copy["ints/6"].Value<int>());
+		ASSERT_EQUAL("test_packed_lists", false, copy["ints"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_packed_lists", 5, five.Value<int>());
+		ASSERT_EQUAL("test_packed_lists", true, ints.Pack());
+		ASSERT_EQUAL("test_packed_lists", 500, ints.Span<int>()[500]);
+		ASSERT_EQUAL("test_packed_lists", false, cfg["mixed"].Value<Item::List>().Pack());
+
+		// Packed values are checked for duplicates when the list is unique
+		std::string duplicated_str = "list = [";
+		for (int i = 0; i < 20; i++)
+			duplicated_str += " " + std::to_string(i % 10);
+		duplicated_str += " ]\n";
+		thrown = false;
+		try {
+			Config duplicated;
+			duplicated.PackMode(PackMode::Values);
+			duplicated << duplicated_str;
+		}
+		catch (const StormByte::Config::Exception&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_packed_lists", true, thrown);
+		Config kept;
+		kept.OnExistingAction(OnExistingAction::Keep);
+		kept.PackMode(PackMode::Values);
+		kept << duplicated_str;
+		ASSERT_EQUAL("test_packed_lists", std::size_t(10), kept["list"].Value<Item::List>().Size());
+		Config appended;
+		appended.ListMode(ListMode::Append);
+		appended.ParseMode(ParseMode::Lazy);
+		appended.PackMode(PackMode::Values);
+		appended << duplicated_str + "flags = [ true false true true false true true false true true false true true false true true ]\n";
+		ASSERT_EQUAL("test_packed_lists", std::size_t(20), appended["list"].Value<Item::List>().Span<int>().size());
+		const std::vector<bool>& flags = appended["flags"].Value<Item::List>().Bits();
+		ASSERT_EQUAL("test_packed_lists", std::size_t(16), flags.size());
+		ASSERT_EQUAL("test_packed_lists", false, static_cast<bool>(flags[1]));
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_packed_lists", result);
+}
+
+int test_string_views() {
+	int result = 0;
+	try {
+		Config cfg;
+		cfg.StringMode(StringMode::View);
+		cfg.ReferenceMode(ReferenceMode::Resolve);
+		{
+			// Parsed text is kept by the configuration, not by the caller
+			const std::string text = "name = \"server\"\nescaped = \"a\\tb\"\n# note\nempty = \"\"\nref = \"${name}_1\"\n";
+			cfg << text;
+		}
+		const auto& name = cfg["name"].Value<Item::Value<std::string>>();
+		ASSERT_EQUAL("test_string_views", true, name.IsView());
+		ASSERT_EQUAL("test_string_views", std::string_view("server"), cfg["name"].View());
+		ASSERT_EQUAL("test_string_views", true, name.IsView());
+		ASSERT_EQUAL("test_string_views", false, cfg["escaped"].Value<Item::Value<std::string>>().IsView());
+		ASSERT_EQUAL("test_string_views", std::string_view("a\tb"), cfg["escaped"].View());
+		ASSERT_EQUAL("test_string_views", std::string_view(""), cfg["empty"].View());
+		ASSERT_EQUAL("test_string_views", std::string_view(" note"), cfg.Items()[2]->View());
+		ASSERT_EQUAL("test_string_views", std::string("server_1"), cfg["ref"].Resolved());
+
+		// Copies and configurations the items are added to keep the text alive
+		Config merged;
+		{
+			Config copy = cfg;
+			merged << copy;
+		}
+		ASSERT_EQUAL("test_string_views", std::string_view("server"), merged["name"].View());
+
+		// Values are copied when accessed as std::string (and can then be modified)
+		Config copied;
+		copied << static_cast<std::string>(cfg);
+		ASSERT_EQUAL("test_string_views", false, copied["name"].Value<Item::Value<std::string>>().IsView());
+		ASSERT_EQUAL("test_string_views", static_cast<std::string>(copied), static_cast<std::string>(cfg));
+		ASSERT_EQUAL("test_string_views", true, Item::Equal(copied["name"], cfg["name"]));
+		ASSERT_EQUAL("test_string_views", Item::Hash(copied["name"]), Item::Hash(cfg["name"]));
+		ASSERT_EQUAL("test_string_views", std::string("server"), cfg["name"].Value<std::string>());
+		ASSERT_EQUAL("test_string_views", false, name.IsView());
+		cfg["name"].Value<std::string>() = "client";
+		ASSERT_EQUAL("test_string_views", std::string_view("client"), cfg["name"].View());
+		ASSERT_EQUAL("test_string_views", std::string_view("server"), merged["name"].View());
+
+		bool thrown = false;
+		try {
+			cfg["ref"].Value<Item::Value<std::string>>();
+			Config numbers;
+			numbers << "number = 1";
+			numbers["number"].View();
+		}
+		catch (const WrongValueTypeConversion&) {
+			thrown = true;
+		}
+		ASSERT_EQUAL("test_string_views", true, thrown);
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_string_views", result);
+}
+
+int test_copy_on_write() {
+	int result = 0;
+	try {
+		Config cfg;
+		cfg << "server = {\n\thost = \"localhost\"\n\tport = 80\n}\nlimits = { connections = 10 }\nports = [ 1 2 3 ]\n";
+		const Config& original = cfg;
+
+		// Copies share the items until they are changed
+		Config copy = cfg;
+		const Config& shared = copy;
+		ASSERT_EQUAL("test_copy_on_write", &original["server"], &shared["server"]);
+		copy["server/port"].Value<int>() = 8080;
+		ASSERT_EQUAL("test_copy_on_write", 80, original["server/port"].Value<int>());
+		ASSERT_EQUAL("test_copy_on_write", 8080, shared["server/port"].Value<int>());
+
+		// Only the items on the changed path are copied
+		ASSERT_EQUAL("test_copy_on_write", true, &original["server"] != &shared["server"]);
+		ASSERT_EQUAL("test_copy_on_write", &original["server/host"], &shared["server/host"]);
+		ASSERT_EQUAL("test_copy_on_write", &original["limits"], &shared["limits"]);
+
+		// Adding and removing items through a copy (or through the original)
+		copy["ports"].Value<Item::List>().Add(Item::Value<int>(4));
+		copy.Remove("limits");
+		cfg["server/host"].Value<std::string>() = "example.com";
+		ASSERT_EQUAL("test_copy_on_write", static_cast<std::size_t>(3), original["ports"].Value<Item::List>().Size());
+		ASSERT_EQUAL("test_copy_on_write", static_cast<std::size_t>(4), shared["ports"].Value<Item::List>().Size());
+		ASSERT_EQUAL("test_copy_on_write", true, original.Exists("limits"));
+		ASSERT_EQUAL("test_copy_on_write", false, shared.Exists("limits"));
+		ASSERT_EQUAL("test_copy_on_write", std::string("localhost"), shared["server/host"].Value<std::string>());
+
+		// Merged items and items reached through Items() too
+		Config merged;
+		merged << cfg;
+		merged["limits/connections"].Value<int>() = 20;
+		ASSERT_EQUAL("test_copy_on_write", 10, original["limits/connections"].Value<int>());
+		Config iterated = cfg;
+		for (auto& item: iterated.Items())
+			ASSERT_EQUAL("test_copy_on_write", 1L, item.use_count());
+		iterated.Items()[0]->Value<Item::Group>().Clear();
+		ASSERT_EQUAL("test_copy_on_write", static_cast<std::size_t>(2), original["server"].Value<Item::Group>().Size());
+
+		// Indexed groups and packed lists
+		Config wide;
+		wide.PackMode(PackMode::Values);
+		wide << "wide = {\n" + [] {
+			std::string keys;
+			for (int i = 0; i < 20; i++)
+				keys += "\tkey" + std::to_string(i) + " = " + std::to_string(i) + "\n";
+			return keys;
+		}() + "}\nnumbers = [ 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 ]\n";
+		Config wide_copy = wide;
+		wide_copy["wide"].Value<Item::Group>().Add(Item::Value<int>("extra", 20));
+		wide_copy["wide"].Value<Item::Group>().Remove("key3");
+		wide_copy["numbers/0"].Value<int>() = 0;
+		ASSERT_EQUAL("test_copy_on_write", false, wide.Exists("wide/extra"));
+		ASSERT_EQUAL("test_copy_on_write", 19, wide["wide/key19"].Value<int>());
+		ASSERT_EQUAL("test_copy_on_write", 3, wide["wide/key3"].Value<int>());
+		ASSERT_EQUAL("test_copy_on_write", 19, wide_copy["wide/key19"].Value<int>());
+		ASSERT_EQUAL("test_copy_on_write", 20, wide_copy["wide/extra"].Value<int>());
+		ASSERT_EQUAL("test_copy_on_write", true, wide["numbers"].Value<Item::List>().IsPacked());
+		ASSERT_EQUAL("test_copy_on_write", 1, wide["numbers"].Value<Item::List>().Span<int>()[0]);
+		ASSERT_EQUAL("test_copy_on_write", 0, wide_copy["numbers/0"].Value<int>());
+	}
+	catch(const StormByte::Config::Exception& e) {
+		std::cerr << e.what() << std::endl;
+		result = 1;
+	}
+	RETURN_TEST("test_copy_on_write", result);
+}
+
+int test_name_validation() {
+	int result = 0;
+	// Only ASCII letters, digits and underscores are allowed, whatever the locale is
+	ASSERT_EQUAL("test_name_validation", true, Item::IsNameValid("Name_2"));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid("2name"));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid("_name"));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid(""));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid("caf\xE9"));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid("\xC3\xA9t\xC3\xA9"));
+	ASSERT_EQUAL("test_name_validation", false, Item::IsNameValid("na-me"));
+	try {
+		Config cfg;
+		cfg << "caf\xE9 = 1\n";
+		result = 1;
+	}
+	catch(const StormByte::Config::ParseError&) {
+		// Expected
+	}
+	RETURN_TEST("test_name_validation", result);
+}
+
 int main() {
     int result = 0;
     try {
@@ -1098,6 +2558,32 @@ int main() {
 		result += size_and_count();
 		result += all_comment_types_test();
 		result += test_on_failure_hook();
+		result += test_string_view_input();
+		result += test_load_file();
+		result += test_numeric_parsing();
+		result += test_string_escapes_at_any_position();
+		result += test_error_line_after_long_spans();
+		result += test_handler_events();
+		result += test_reader_cursor();
+		result += test_lazy_parse_mode();
+		result += test_parallel_parse_mode();
+		result += test_incremental_parser();
+		result += test_discard_comments();
+		result += test_load_many();
+		result += test_load_async();
+		result += test_include_directive();
+		result += test_interpolation();
+		result += test_source_location();
+		result += test_arena_allocation();
+		result += test_item_ownership();
+		result += test_item_visit();
+		result += test_interned_names();
+		result += test_group_index();
+		result += test_list_duplicates();
+		result += test_packed_lists();
+		result += test_string_views();
+		result += test_copy_on_write();
+		result += test_name_validation();
     } catch (const StormByte::Config::Exception& ex) {
         std::cerr << ex.what() << std::endl;
         result++;